@@ -7,4 +7,10 @@ release/json/jmc data/01-FunctionalCase/predict/algo.json data/01-FunctionalCase
 release/json/jmc data/02-RankCase/learn/algo.json data/02-RankCase/learn/data.json data/02-RankCase/learn/desc.json data/02-RankCase/learn/resLearn.json
 release/json/jmc data/02-RankCase/predict/algo.json data/02-RankCase/predict/data.json data/02-RankCase/predict/desc.json data/02-RankCase/learn/resLearn.json data/02-RankCase/predict/resPredict.json
 
+release/json/jmc data/03-OrdinalCase/learn/algo.json data/03-OrdinalCase/learn/data.json data/03-OrdinalCase/learn/desc.json data/03-OrdinalCase/learn/resLearn.json
+release/json/jmc data/03-OrdinalCase/predict/algo.json data/03-OrdinalCase/predict/data.json data/03-OrdinalCase/predict/desc.json data/03-OrdinalCase/learn/resLearn.json data/03-OrdinalCase/predict/resPredict.json
+
+release/json/jmc data/04-MultivariateGaussianCase/learn/algo.json data/04-MultivariateGaussianCase/learn/data.json data/04-MultivariateGaussianCase/learn/desc.json data/04-MultivariateGaussianCase/learn/resLearn.json
+release/json/jmc data/04-MultivariateGaussianCase/predict/algo.json data/04-MultivariateGaussianCase/predict/data.json data/04-MultivariateGaussianCase/predict/desc.json data/04-MultivariateGaussianCase/learn/resLearn.json data/04-MultivariateGaussianCase/predict/resPredict.json
+
 
@@ -58,6 +58,27 @@ bool JSONGraph::exist_payload(const std::vector<std::string>& path, const std::s
 	return true;
 }
 
+bool JSONGraph::is_numeric_payload(const std::vector<std::string>& path, const std::string& name) const {
+	nlohmann::json l;
+	go_to(path, l);
+
+	const nlohmann::json& p = l[name];
+	if (!p.is_array()) {
+		return false;
+	}
+
+	bool hasNumber = false; // a column with only null elements is read as strings, since its type can not be deduced
+	for (nlohmann::json::const_iterator it = p.begin(); it != p.end(); ++it) {
+		if (it->is_number()) {
+			hasNumber = true;
+		} else if (!it->is_null()) {
+			return false;
+		}
+	}
+
+	return hasNumber;
+}
+
 void JSONGraph::go_to(const std::vector<std::string>& path, nlohmann::json& l) const {
 	go_to(path, 0, j_, l);
 }
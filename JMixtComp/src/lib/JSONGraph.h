@@ -88,6 +88,12 @@ public:
 
 	bool exist_payload(const std::vector<std::string>& path, const std::string& name) const;
 
+	/**
+	 * Check if the payload is an array of numbers, in which case it can be read as a Vector<Real> instead of a vector of strings. null
+	 * elements are accepted, and correspond to missing values, but at least one element must be a number.
+	 */
+	bool is_numeric_payload(const std::vector<std::string>& path, const std::string& name) const;
+
 	void name_payload(const std::vector<std::string>& path, std::list<std::string>& l) const;
 
 private:
@@ -0,0 +1,139 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "binaryFormat.h"
+
+namespace mixt {
+
+const std::uint32_t binaryFormatVersion = 1;
+
+std::uint64_t fnv1a64(const std::uint8_t* data, std::size_t size) {
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+void writeBinary(const char* magic, const nlohmann::json& j, std::ostream& os) {
+	std::vector<std::uint8_t> payload = nlohmann::json::to_cbor(j);
+
+	BinaryHeader header;
+	std::memcpy(header.magic_, magic, sizeof(header.magic_));
+	header.version_ = binaryFormatVersion;
+	header.reserved_ = 0;
+	header.payloadSize_ = payload.size();
+	header.checksum_ = fnv1a64(payload.data(), payload.size());
+
+	os.write(reinterpret_cast<const char*>(&header), sizeof(BinaryHeader));
+	os.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+}
+
+void writeBinary(const char* magic, const nlohmann::json& j, const std::string& path) {
+	std::ofstream os(path, std::ios::binary);
+	if (!os.good()) {
+		throw(std::string("Binary file: " + path + " could not be opened for writing."));
+	}
+	writeBinary(magic, j, os);
+}
+
+nlohmann::json readBinary(const char* magic, const std::uint8_t* buffer, std::size_t size) {
+	if (size < sizeof(BinaryHeader)) {
+		throw(std::string("Binary file is too short to contain a header."));
+	}
+
+	BinaryHeader header;
+	std::memcpy(&header, buffer, sizeof(BinaryHeader));
+
+	if (std::memcmp(header.magic_, magic, sizeof(header.magic_)) != 0) {
+		throw(std::string("Binary file does not start with the expected magic string: ") + magic + ".");
+	}
+
+	if (header.version_ != binaryFormatVersion) {
+		throw(std::string("Binary file version " + std::to_string(header.version_) + " is not supported, expected version " + std::to_string(binaryFormatVersion) + "."));
+	}
+
+	if (size - sizeof(BinaryHeader) != header.payloadSize_) {
+		throw(std::string("Binary file payload size does not match the size in the header, the file is truncated or corrupted."));
+	}
+
+	const std::uint8_t* payload = buffer + sizeof(BinaryHeader);
+	if (fnv1a64(payload, header.payloadSize_) != header.checksum_) {
+		throw(std::string("Binary file checksum does not match, the file is corrupted."));
+	}
+
+	try {
+		return nlohmann::json::from_cbor(payload, payload + header.payloadSize_);
+	} catch (const nlohmann::json::exception& e) {
+		throw(std::string("Binary file payload could not be decoded: ") + e.what());
+	}
+}
+
+nlohmann::json readBinary(const char* magic, const std::string& path) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		throw(std::string("Binary file: " + path + " could not be opened."));
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == -1 || st.st_size == 0) {
+		close(fd);
+		throw(std::string("Binary file: " + path + " is empty or could not be read."));
+	}
+
+	std::size_t size = st.st_size;
+	void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); // the mapping stays valid after the descriptor is closed
+	if (mapping == MAP_FAILED) {
+		throw(std::string("Binary file: " + path + " could not be memory mapped."));
+	}
+
+	nlohmann::json j;
+	try {
+		j = readBinary(magic, static_cast<const std::uint8_t*>(mapping), size);
+	} catch (...) {
+		munmap(mapping, size);
+		throw;
+	}
+
+	munmap(mapping, size);
+	return j;
+}
+
+bool hasMagic(const char* magic, const std::string& path) {
+	std::ifstream is(path, std::ios::binary);
+	char fileMagic[sizeof(BinaryHeader::magic_)];
+	is.read(fileMagic, sizeof(fileMagic));
+	return is.gcount() == sizeof(fileMagic) && std::memcmp(fileMagic, magic, sizeof(fileMagic)) == 0;
+}
+
+}
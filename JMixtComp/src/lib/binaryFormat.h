@@ -0,0 +1,80 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef JSON_BINARYFORMAT_H
+#define JSON_BINARYFORMAT_H
+
+#include <cstdint>
+#include <iostream>
+#include "json.hpp"
+
+namespace mixt {
+
+/**
+ * Container of the binary files of JMixtComp (see binaryModel.h): a fixed size header followed by a CBOR encoded payload.
+ * All header fields are stored in the byte order of the host.
+ *
+ * offset  size  content
+ * 0       8     magic string, identifying the content of the file
+ * 8       4     format version
+ * 12      4     reserved, set to 0
+ * 16      8     size in bytes of the payload
+ * 24      8     FNV-1a 64 bits checksum of the payload
+ * 32      -     payload
+ */
+struct BinaryHeader {
+	char magic_[8];
+	std::uint32_t version_;
+	std::uint32_t reserved_;
+	std::uint64_t payloadSize_;
+	std::uint64_t checksum_;
+};
+
+extern const std::uint32_t binaryFormatVersion;
+
+std::uint64_t fnv1a64(const std::uint8_t* data, std::size_t size);
+
+void writeBinary(const char* magic, const nlohmann::json& j, std::ostream& os);
+
+void writeBinary(const char* magic, const nlohmann::json& j, const std::string& path);
+
+/**
+ * Decode a buffer containing a header and its payload. Throws a std::string if the buffer is not valid, or if its magic string is not
+ * the expected one.
+ */
+nlohmann::json readBinary(const char* magic, const std::uint8_t* buffer, std::size_t size);
+
+/**
+ * Memory map the file and decode it directly from the mapping, without intermediate copy of the file content. The mapping is released
+ * before returning: the whole payload is decoded into a json owned by the caller, so that nothing is shared between processes reading the
+ * same file, apart from the page cache of the system.
+ */
+nlohmann::json readBinary(const char* magic, const std::string& path);
+
+/**
+ * Check the magic string at the beginning of a file.
+ */
+bool hasMagic(const char* magic, const std::string& path);
+
+}
+
+#endif
@@ -0,0 +1,107 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <vector>
+
+#include "binaryModel.h"
+
+namespace mixt {
+
+const char binaryModelMagic[8] = { 'M', 'C', 'M', 'O', 'D', 'E', 'L', '\0' };
+
+nlohmann::json extractModel(const nlohmann::json& resLearn) {
+	if (!resLearn.contains("variable") || !resLearn["variable"].contains("param") || !resLearn["variable"].contains("type")) {
+		throw(std::string("resLearn does not contain variable/param and variable/type, it can not be used as a model."));
+	}
+
+	nlohmann::json model;
+	model["algo"]["nClass"] = resLearn.at("algo").at("nClass");
+	model["variable"]["type"] = resLearn["variable"]["type"];
+
+	nlohmann::json& param = model["variable"]["param"];
+	param = resLearn["variable"]["param"];
+	for (nlohmann::json::iterator itVar = param.begin(); itVar != param.end(); ++itVar) { // param logs are only used for diagnostics
+		itVar->erase("log");
+		for (nlohmann::json::iterator itSub = itVar->begin(); itSub != itVar->end(); ++itSub) {
+			if (itSub->is_object()) {
+				itSub->erase("log");
+			}
+		}
+	}
+
+	return model;
+}
+
+nlohmann::json parseModel(std::istream& is) {
+	std::vector<std::string> path;
+
+	nlohmann::json::parser_callback_t filter = [&path](int depth, nlohmann::json::parse_event_t event, nlohmann::json& parsed) {
+		if (event != nlohmann::json::parse_event_t::key) {
+			return true;
+		}
+
+		path.resize(depth - 1);
+		path.push_back(parsed.get<std::string>());
+
+		if (depth == 1) {
+			return path[0] == "algo" || path[0] == "variable";
+		}
+
+		if (path[0] == "algo") {
+			return depth != 2 || path[1] == "nClass";
+		}
+
+		if (depth == 2) {
+			return path[1] == "type" || path[1] == "param";
+		}
+
+		if (path[1] == "param" && 4 <= depth) {
+			return path.back() != "log";
+		}
+
+		return true;
+	};
+
+	return nlohmann::json::parse(is, filter);
+}
+
+void writeBinaryModel(const nlohmann::json& model, std::ostream& os) {
+	writeBinary(binaryModelMagic, model, os);
+}
+
+void writeBinaryModel(const nlohmann::json& model, const std::string& path) {
+	writeBinary(binaryModelMagic, model, path);
+}
+
+nlohmann::json readBinaryModel(const std::uint8_t* buffer, std::size_t size) {
+	return readBinary(binaryModelMagic, buffer, size);
+}
+
+nlohmann::json readBinaryModel(const std::string& path) {
+	return readBinary(binaryModelMagic, path);
+}
+
+bool isBinaryModel(const std::string& path) {
+	return hasMagic(binaryModelMagic, path);
+}
+
+}
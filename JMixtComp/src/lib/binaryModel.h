@@ -0,0 +1,62 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef JSON_BINARYMODEL_H
+#define JSON_BINARYMODEL_H
+
+#include <iostream>
+#include "json.hpp"
+
+#include "binaryFormat.h"
+
+namespace mixt {
+
+/**
+ * Compact model format, in the container described in binaryFormat.h, with the magic string "MCMODEL". The payload only contains what
+ * predict needs: algo/nClass, variable/type and variable/param without the log of the SEM iterations.
+ */
+extern const char binaryModelMagic[8];
+
+/**
+ * Extract the subset of a complete resLearn object that is used in prediction.
+ */
+nlohmann::json extractModel(const nlohmann::json& resLearn);
+
+/**
+ * Parse a resLearn json stream, discarding on the fly the parts that are not used in prediction (data, mixture, param logs...).
+ * The peak memory is therefore proportional to the size of the model and not to the size of resLearn.
+ */
+nlohmann::json parseModel(std::istream& is);
+
+void writeBinaryModel(const nlohmann::json& model, std::ostream& os);
+
+void writeBinaryModel(const nlohmann::json& model, const std::string& path);
+
+nlohmann::json readBinaryModel(const std::uint8_t* buffer, std::size_t size);
+
+nlohmann::json readBinaryModel(const std::string& path);
+
+bool isBinaryModel(const std::string& path);
+
+}
+
+#endif
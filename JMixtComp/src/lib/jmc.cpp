@@ -22,23 +22,91 @@
 
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <fstream>
+#include <thread>
+#include <vector>
 #include "json.hpp"
 
 #include <Run/Learn.h>
 #include <Run/Predict.h>
 #include <Various/Constants.h>
+#include "binaryModel.h"
 #include "JSONGraph.h"
+#include "streamPredict.h"
 
 using namespace mixt;
 
+/**
+ * Load the model used in prediction, either from a binary model, from a resLearn json file, or from a resLearn written with
+ * outputFormat: binary (plain CBOR). Parsing errors are reported as std::string, like the other errors of jmc.
+ */
+nlohmann::json loadModel(const std::string& resLearnFile) {
+	if (isBinaryModel(resLearnFile)) {
+		return readBinaryModel(resLearnFile);
+	}
+
+	std::ifstream resLearnStream(resLearnFile, std::ios::binary);
+	if (resLearnStream.good() == false) {
+		throw(std::string("Check that resLearn: " + resLearnFile + " path is correct"));
+	}
+
+	try {
+		if ((resLearnStream.peek() & 0xE0) == 0xA0) { // CBOR map header, which can not start a json text
+			std::vector<std::uint8_t> cbor((std::istreambuf_iterator<char>(resLearnStream)), std::istreambuf_iterator<char>());
+			return extractModel(nlohmann::json::from_cbor(cbor));
+		}
+
+		return parseModel(resLearnStream);
+	} catch (const nlohmann::json::exception& e) {
+		throw(std::string("resLearn: " + resLearnFile + " could not be read, it must be a resLearn written by jmc in any outputFormat, or a binary model. ") + e.what());
+	}
+}
+
 int main(int argc, char* argv[]) {
 	try {
 		std::cout << "JMixtComp" << std::endl;
 
-		if (argc < 4) {
+		if (argc == 7 && std::string(argv[1]) == "--stream") { // streaming prediction by chunks, see streamPredict.h
+			std::ifstream algoStream(argv[2]);
+			std::ifstream dataStream(argv[3]);
+			std::ifstream descStream(argv[4]);
+			if (algoStream.good() == false || dataStream.good() == false || descStream.good() == false) {
+				std::cout << "Check that algo: " << argv[2] << ", data: " << argv[3] << ", and model: " << argv[4] << " paths are correct" << std::endl;
+				return 0;
+			}
+
+			nlohmann::json algoJSON;
+			algoStream >> algoJSON;
+			JSONGraph algoG(algoJSON);
+
+			nlohmann::json descJSON;
+			descStream >> descJSON;
+
+			Index chunkSize = 10000;
+			if (algoG.exist_payload( { }, "chunkSize")) {
+				algoG.get_payload( { }, "chunkSize", chunkSize);
+			}
+
+			Index nThread = std::thread::hardware_concurrency();
+			Index nWorker = (2 < nThread) ? nThread - 2 : 1; // the two remaining threads read and write
+			if (algoG.exist_payload( { }, "nWorker")) {
+				algoG.get_payload( { }, "nWorker", nWorker);
+			}
+
+			nlohmann::json modelJSON = loadModel(argv[5]);
+
+			std::ofstream resStream(argv[6]);
+			std::string warnLog = streamPredict(algoJSON, descJSON, modelJSON["variable"]["param"], dataStream, resStream, chunkSize, nWorker);
+			if (warnLog.size() > 0) {
+				std::cout << warnLog << std::endl;
+			}
+			return 0;
+		}
+
+		if (argc < 5) {
 			std::cout
-					<< "JMixtComp should be called with 4 parameters (paths to algo, data, model, resLearn) in learn mode and 5 parameters (paths to algo, data, model, resLearn, resPredict) in predict mode. It has been called with "
+					<< "JMixtComp should be called with 4 or 5 parameters (paths to algo, data, model, resLearn and optionally binary model) in learn mode and 5 parameters (paths to algo, data, model, resLearn or binary model, resPredict) in predict mode. It has been called with "
 					<< argc - 1 << " parameters." << std::endl;
 			return 0;
 		}
@@ -70,6 +138,14 @@ int main(int argc, char* argv[]) {
 
 			std::string mode = algoG.get_payload<std::string>( { }, "mode");
 
+			std::string outputFormat = "pretty";
+			if (algoG.exist_payload( { }, "outputFormat")) {
+				algoG.get_payload( { }, "outputFormat", outputFormat);
+			}
+			if (outputFormat != "pretty" && outputFormat != "compact" && outputFormat != "binary") {
+				std::cout << "outputFormat: " << outputFormat << " not recognized, pretty will be used. Please choose pretty, compact or binary." << std::endl;
+			}
+
 			JSONGraph resG;
 			std::string resFile;
 
@@ -85,23 +161,13 @@ int main(int argc, char* argv[]) {
 
 				resFile = argv[5];
 
-				std::ifstream resLearnStream(resLearnFile);
-
-				if (resLearnStream.good() == false) {
-					std::cout << "Check that resLearn: " << resLearnFile << " path is correct" << std::endl;
-				}else{
-					nlohmann::json resLearnJSON;
-					resLearnStream >> resLearnJSON;
-
-					try {
-						JSONGraph paramG(resLearnJSON["variable"]["param"]);
-						predict(algoG, dataG, descG, paramG, resG);
-					} catch (const std::string& s) {
-						warnLog += s;
-					}
+				try {
+					nlohmann::json modelJSON = loadModel(resLearnFile);
+					JSONGraph paramG(modelJSON["variable"]["param"]);
+					predict(algoG, dataG, descG, paramG, resG);
+				} catch (const std::string& s) {
+					warnLog += s;
 				}
-
-
 			} else {
 				warnLog += "mode :" + mode + " not recognized. Please choose learn or predict." + eol;
 			}
@@ -110,8 +176,25 @@ int main(int argc, char* argv[]) {
 				resG.add_payload( { }, "warnLog", warnLog);
 			}
 
-			std::ofstream o(resFile);
-			o << std::setw(4) << resG.getJ() << std::endl;
+			if (outputFormat == "binary") { // CBOR encoding of the output object
+				std::vector<std::uint8_t> cbor = nlohmann::json::to_cbor(resG.getJ());
+				std::ofstream o(resFile, std::ios::binary);
+				o.write(reinterpret_cast<const char*>(cbor.data()), cbor.size());
+			} else if (outputFormat == "compact") {
+				std::ofstream o(resFile);
+				o << resG.getJ() << std::endl;
+			} else {
+				std::ofstream o(resFile);
+				o << std::setw(4) << resG.getJ() << std::endl;
+			}
+
+			if (mode == "learn" && argc == 6 && !resG.getJ().contains("warnLog")) { // written after resLearn, so that a failure here does not lose the learn results
+				try {
+					writeBinaryModel(extractModel(resG.getJ()), argv[5]);
+				} catch (const std::string& s) {
+					std::cout << "resLearn: " << resLearnFile << " has been written, but the binary model could not be written. " << s << std::endl;
+				}
+			}
 		}
 	} catch (const std::string& s) {
 		std::cout << s << std::endl;
@@ -0,0 +1,226 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <Run/Predict.h>
+#include <Statistic/RNG.h>
+#include "JSONGraph.h"
+#include "streamPredict.h"
+
+namespace mixt {
+
+namespace {
+
+/** Number of deterministic seeds of each caller type reserved for a chunk, larger than what is needed by any predict run. */
+const Index nSeedPerChunk = 1 << 16;
+
+struct Chunk {
+	Index index;
+	Index firstInd;
+	Index nInd;
+	nlohmann::json data;
+};
+
+/**
+ * Run predict on a single chunk and return its result serialized as a single line. In deterministic mode, the seeds are derived from
+ * the index of the chunk, so that they do not depend on the chunks predicted concurrently by the other workers.
+ */
+std::string predictChunk(const nlohmann::json& algo, const nlohmann::json& desc, const nlohmann::json& param, const Chunk& chunk) {
+	SeedBase seedBase(deterministicInitialSeed() + chunk.index * nSeedPerChunk);
+
+	nlohmann::json algoChunk = algo;
+	algoChunk["nInd"] = chunk.nInd;
+
+	JSONGraph algoG(algoChunk);
+	JSONGraph dataG(chunk.data);
+	JSONGraph descG(desc);
+	JSONGraph paramG(param);
+	JSONGraph resG;
+
+	try {
+		predict(algoG, dataG, descG, paramG, resG);
+	} catch (const std::string& s) {
+		resG.add_payload( { }, "warnLog", s);
+	} catch (const std::exception& e) {
+		resG.add_payload( { }, "warnLog", std::string(e.what()));
+	}
+
+	resG.add_payload( { "chunk" }, "index", chunk.index);
+	resG.add_payload( { "chunk" }, "firstInd", chunk.firstInd);
+	resG.add_payload( { "chunk" }, "nInd", chunk.nInd);
+
+	return resG.getJ().dump();
+}
+
+}
+
+std::string streamPredict(const nlohmann::json& algo, const nlohmann::json& desc, const nlohmann::json& param, std::istream& is, std::ostream& os,
+		Index chunkSize, Index nWorker) {
+	if (chunkSize == 0) {
+		return "chunkSize must be a positive integer, currently chunkSize = " + std::to_string(chunkSize) + "." + eol;
+	}
+
+	if (nWorker == 0) {
+		nWorker = 1;
+	}
+
+	std::vector<std::string> varNames;
+	for (nlohmann::json::const_iterator it = desc.begin(); it != desc.end(); ++it) {
+		varNames.push_back(it.key());
+	}
+
+	const Index maxInFlight = nWorker + 2;
+
+	std::mutex mutex; // protects all the variables below
+	std::condition_variable readCond; // the reader waits for the number of chunks in memory to decrease
+	std::condition_variable workCond; // the workers wait for a chunk to be read
+	std::condition_variable writeCond; // the writer waits for the next chunk to be predicted
+
+	Index nInFlight = 0; // chunks read and not yet written
+	Index nChunk = 0; // chunks read
+	bool readFinished = false;
+	std::string readLog;
+	std::deque<Chunk> toPredict;
+	std::map<Index, std::string> predicted; // results indexed by chunk, a worker can finish before another that started earlier
+
+	std::thread reader([&]() {
+		Index nInd = 0;
+		Index nLine = 0;
+		std::string line;
+		bool eof = false;
+
+		try {
+			while (!eof) {
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					readCond.wait(lock, [&]() {return nInFlight < maxInFlight;});
+				}
+
+				Chunk chunk;
+				chunk.index = nChunk;
+				chunk.firstInd = nInd;
+				chunk.nInd = 0;
+				for (const std::string& name : varNames) {
+					chunk.data[name] = nlohmann::json::array();
+				}
+
+				while (chunk.nInd < chunkSize) {
+					if (!std::getline(is, line)) {
+						eof = true;
+						break;
+					}
+					++nLine;
+
+					if (line.find_first_not_of(" \t\r") == std::string::npos) {
+						continue;
+					}
+
+					nlohmann::json ind = nlohmann::json::parse(line);
+					if (!ind.is_object()) {
+						throw(std::string("Line ") + std::to_string(nLine) + " of the data stream is not a json object." + eol);
+					}
+
+					for (const std::string& name : varNames) {
+						nlohmann::json::const_iterator it = ind.find(name);
+						chunk.data[name].push_back(it == ind.end() ? nlohmann::json(nullptr) : *it); // null is missing, and keeps numeric columns numeric
+					}
+					++chunk.nInd;
+				}
+
+				if (0 < chunk.nInd) {
+					nInd += chunk.nInd;
+					std::lock_guard<std::mutex> lock(mutex);
+					toPredict.push_back(std::move(chunk));
+					++nInFlight;
+					++nChunk;
+					workCond.notify_one();
+				}
+			}
+		} catch (const std::string& s) {
+			readLog = s;
+		} catch (const nlohmann::json::exception& e) {
+			readLog = std::string("Line ") + std::to_string(nLine) + " of the data stream could not be parsed: " + e.what() + eol;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		readFinished = true;
+		workCond.notify_all();
+		writeCond.notify_all();
+	});
+
+	std::vector<std::thread> workers;
+	for (Index w = 0; w < nWorker; ++w) {
+		workers.emplace_back([&]() {
+			while (true) {
+				Chunk chunk;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					workCond.wait(lock, [&]() {return !toPredict.empty() || readFinished;});
+					if (toPredict.empty()) {
+						return;
+					}
+					chunk = std::move(toPredict.front());
+					toPredict.pop_front();
+				}
+
+				std::string res = predictChunk(algo, desc, param, chunk);
+
+				std::lock_guard<std::mutex> lock(mutex);
+				predicted[chunk.index] = std::move(res);
+				writeCond.notify_one();
+			}
+		});
+	}
+
+	for (Index next = 0;; ++next) { // results are written in the order of the input
+		std::string res;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			writeCond.wait(lock, [&]() {return predicted.count(next) == 1 || (readFinished && next == nChunk);});
+			if (predicted.count(next) == 0) {
+				break;
+			}
+			res = std::move(predicted[next]);
+			predicted.erase(next);
+		}
+
+		os << res << std::endl;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		--nInFlight;
+		readCond.notify_one();
+	}
+
+	reader.join();
+	for (std::thread& w : workers) {
+		w.join();
+	}
+
+	return readLog;
+}
+
+}
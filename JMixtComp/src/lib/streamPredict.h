@@ -0,0 +1,55 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef JSON_STREAMPREDICT_H
+#define JSON_STREAMPREDICT_H
+
+#include <iostream>
+#include "json.hpp"
+
+#include <LinAlg/LinAlg.h>
+
+namespace mixt {
+
+/**
+ * Prediction on a dataset of arbitrary size, with a memory footprint bounded by the size of the chunks.
+ *
+ * The input stream contains one individual per line, as a json object associating the name of each variable to its value, in the same
+ * format as in data.json. Variables of desc absent from a line are considered completely missing. Individuals are grouped in chunks of
+ * chunkSize consecutive lines, and predict is run independently on each chunk with the same parameters. The result of each chunk is
+ * written as a single line of compact json in the output stream, in the order of the input, with an additional "chunk" object
+ * containing the index of the chunk, the index of its first individual and its number of individuals.
+ *
+ * Reading, prediction and writing are pipelined: one thread reads and splits the input, nWorker threads run the predictions and the
+ * calling thread writes the results. At most nWorker + 2 chunks are in memory at the same time. In deterministic mode, the random seeds
+ * of each chunk are derived from its index, so that the results do not depend on the number of workers and the scheduling of the threads.
+ *
+ * @param algo algo object, without nInd which is set for each chunk
+ * @param param variable/param object of a resLearn or of a binary model
+ * @return warnings that prevent the processing of the input, the warnings of each chunk are in its result
+ */
+std::string streamPredict(const nlohmann::json& algo, const nlohmann::json& desc, const nlohmann::json& param, std::istream& is, std::ostream& os,
+		Index chunkSize, Index nWorker);
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "json.hpp"
 
 #include <iostream>
+#include <limits>
 #include <LinAlg/names.h>
 
 namespace mixt {
@@ -37,6 +38,37 @@ void translateJSONToCPP(const nlohmann::json& in, OutType& out) {
 	out = in.get<OutType>();
 }
 
+/**
+ * Data columns are read as vectors of strings by the models that parse their own format. A column may contain numbers, which are
+ * printed back, and null elements (for example the absent variables in streamPredict), which are translated to the missing value "?".
+ */
+inline void translateJSONToCPP(const nlohmann::json& in, std::vector<std::string>& out) {
+	out.resize(in.size());
+
+	for (Index i = 0, nrow = in.size(); i < nrow; ++i) {
+		if (in[i].is_string()) {
+			out[i] = in[i].get<std::string>();
+		} else if (in[i].is_null()) {
+			out[i] = "?";
+		} else {
+			out[i] = in[i].dump();
+		}
+	}
+}
+
+/**
+ * Used for numeric data columns. null elements are translated to nan.
+ */
+template<typename T>
+void translateJSONToCPP(const nlohmann::json& in, Vector<T>& out) {
+	Index nrow = in.size();
+	out.resize(nrow);
+
+	for (Index i = 0; i < nrow; ++i) {
+		out(i) = in[i].is_null() ? std::numeric_limits<T>::quiet_NaN() : in[i].get<T>();
+	}
+}
+
 template<typename T>
 void translateJSONToCPP(const nlohmann::json& in, NamedVector<T>& out) {
 	Index nrow = in.at("nrow").get<Index>();
@@ -159,3 +159,23 @@ TEST(JSONSGraph, AddSubGraph) {
 
 	ASSERT_EQ(gIn.get(), expected);
 }
+
+TEST(JSONGraph, numericPayload) {
+	JSONGraph g;
+	g.set(std::string(R"-({"num":[1.5,null,3],"str":["1.5","?","3"],"null":[null,null]})-"));
+
+	ASSERT_TRUE(g.is_numeric_payload( { }, "num"));
+	ASSERT_FALSE(g.is_numeric_payload( { }, "str"));
+	ASSERT_FALSE(g.is_numeric_payload( { }, "null"));
+
+	Vector<Real> comp;
+	g.get_payload( { }, "num", comp);
+	ASSERT_EQ(3, comp.size());
+	ASSERT_EQ(1.5, comp(0));
+	ASSERT_TRUE(std::isnan(comp(1)));
+	ASSERT_EQ(3., comp(2));
+
+	std::vector<std::string> nullStr;
+	g.get_payload( { }, "null", nullStr);
+	ASSERT_EQ(std::vector<std::string>({ "?", "?" }), nullStr);
+}
@@ -0,0 +1,75 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+#include "jsonIO.h"
+
+using namespace mixt;
+
+/**
+ * Learn an Ordinal variable with several classes. mu is sampled from the observed probabilities in mStep, and the paths must stay compatible
+ * with it, otherwise the completed probability of some individuals is null in every class and the learn fails.
+ */
+TEST(OrdinalMixture, learnSeveralClasses) {
+	Index nInd = 200;
+	int nbModality = 5;
+	std::vector<int> mu = { 0, 1, 3, 4 };
+	Real pi = 0.7;
+
+	nlohmann::json algo = nlohmann::json::parse(
+			R"-({"nClass":4,"nbBurnInIter":20,"nbIter":20,"nbGibbsBurnInIter":20,"nbGibbsIter":20,"nInitPerClass":20,"nSemTry":20,"confidenceLevel":0.95,"ratioStableCriterion":0.95,"nStableCriterion":10,"mode":"learn"})-");
+	algo["nInd"] = nInd;
+	nlohmann::json desc = nlohmann::json::parse(R"-({"z_class":{"type":"LatentClass","paramStr":""},"ordinal":{"type":"Ordinal","paramStr":""}})-");
+
+	BOSPath path;
+	path.setInit(0, nbModality - 1);
+	path.setEnd(0, nbModality - 1);
+
+	std::vector<std::string> zClass(nInd, "?");
+	std::vector<std::string> ordinal(nInd);
+	for (Index i = 0; i < nInd; ++i) {
+		path.forwardSamplePath(mu[i % mu.size()], pi);
+		if (i % 10 == 0) {
+			ordinal[i] = "?";
+		} else if (i % 15 == 0) {
+			ordinal[i] = "[" + std::to_string(std::max(path.x(), 1) - 1 + minModality) + ":" + std::to_string(std::max(path.x(), 1) + minModality) + "]";
+		} else {
+			ordinal[i] = std::to_string(path.x() + minModality);
+		}
+	}
+	nlohmann::json data;
+	data["z_class"] = zClass;
+	data["ordinal"] = ordinal;
+
+	for (Index run = 0; run < 5; ++run) {
+		JSONGraph algoG(algo);
+		JSONGraph dataG(data);
+		JSONGraph descG(desc);
+		JSONGraph resG;
+
+		learn(algoG, dataG, descG, resG);
+
+		ASSERT_FALSE(resG.getJ().contains("warnLog")) << resG.getJ()["warnLog"];
+		ASSERT_LT(minInf, resG.getJ()["mixture"]["lnObservedLikelihood"].get<Real>());
+	}
+}
@@ -0,0 +1,78 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+#include "jsonIO.h"
+#include "binaryModel.h"
+
+using namespace mixt;
+
+namespace {
+
+const std::string resLearnStr =
+		R"-({"algo":{"nClass":2,"nbIter":10},"mixture":{"BIC":-12.5},"variable":{"type":{"z_class":"LatentClass","gaussian":"Gaussian"},"data":{"gaussian":{"completed":[1.0,2.0]}},"param":{"z_class":{"stat":[0.5,0.5],"log":[0.4,0.6],"paramStr":""},"gaussian":{"stat":[1.0,2.0],"log":[[1.0],[2.0]],"paramStr":""},"functional":{"alpha":{"stat":[3.0],"log":[[3.0]]},"paramStr":"nSub: 2, nCoeff: 2"}}}})-";
+
+const std::string modelStr =
+		R"-({"algo":{"nClass":2},"variable":{"param":{"functional":{"alpha":{"stat":[3.0]},"paramStr":"nSub: 2, nCoeff: 2"},"gaussian":{"paramStr":"","stat":[1.0,2.0]},"z_class":{"paramStr":"","stat":[0.5,0.5]}},"type":{"gaussian":"Gaussian","z_class":"LatentClass"}}})-";
+
+}
+
+TEST(binaryModel, extractModel) {
+	nlohmann::json model = extractModel(nlohmann::json::parse(resLearnStr));
+	ASSERT_EQ(nlohmann::json::parse(modelStr), model);
+}
+
+TEST(binaryModel, parseModel) {
+	std::istringstream is(resLearnStr);
+	nlohmann::json model = parseModel(is);
+	ASSERT_EQ(nlohmann::json::parse(modelStr), model);
+}
+
+TEST(binaryModel, roundTrip) {
+	nlohmann::json model = nlohmann::json::parse(modelStr);
+
+	std::ostringstream os;
+	writeBinaryModel(model, os);
+	std::string buffer = os.str();
+
+	nlohmann::json comp = readBinaryModel(reinterpret_cast<const std::uint8_t*>(buffer.data()), buffer.size());
+	ASSERT_EQ(model, comp);
+
+	JSONGraph paramG(comp["variable"]["param"]);
+	std::vector<Real> stat;
+	paramG.get_payload( { "z_class" }, "stat", stat);
+	ASSERT_EQ(2, stat.size());
+	ASSERT_EQ(0.5, stat[0]);
+}
+
+TEST(binaryModel, corruptedPayload) {
+	std::ostringstream os;
+	writeBinaryModel(nlohmann::json::parse(modelStr), os);
+	std::string buffer = os.str();
+	buffer[buffer.size() - 1] ^= 0x01;
+
+	ASSERT_THROW(readBinaryModel(reinterpret_cast<const std::uint8_t*>(buffer.data()), buffer.size()), std::string);
+	ASSERT_THROW(readBinaryModel(reinterpret_cast<const std::uint8_t*>(buffer.data()), buffer.size() - 1), std::string);
+}
@@ -0,0 +1,133 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <cmath>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+#include "jsonIO.h"
+#include "streamPredict.h"
+
+using namespace mixt;
+
+namespace {
+
+const std::string algoStr =
+		R"-({"nClass":2,"nbBurnInIter":5,"nbIter":5,"nbGibbsBurnInIter":5,"nbGibbsIter":5,"nInitPerClass":2,"nSemTry":1,"confidenceLevel":0.95,"ratioStableCriterion":0.9,"nStableCriterion":7,"mode":"predict"})-";
+
+const std::string descStr = R"-({"z_class":{"type":"LatentClass","paramStr":""},"gaussian":{"type":"Gaussian","paramStr":""}})-";
+
+const std::string paramStr =
+		R"-({"z_class":{"paramStr":"nModality: 2","stat":{"colNames":["median"],"ctype":"Matrix","data":[[0.5],[0.5]],"dtype":"Real","ncol":1,"nrow":2,"rowNames":["k: 1","k: 2"]}},"gaussian":{"paramStr":"","stat":{"colNames":["median"],"ctype":"Matrix","data":[[-5.0],[1.0],[5.0],[1.0]],"dtype":"Real","ncol":1,"nrow":4,"rowNames":["k: 1, mean: ","k: 1, sd","k: 2, mean: ","k: 2, sd"]}}})-";
+
+}
+
+TEST(streamPredict, chunks) {
+	std::stringstream data;
+	for (Index i = 0; i < 10; ++i) {
+		data << R"-({"gaussian":")-" << (i % 2 == 0 ? -5.0 : 5.0) << R"-("})-" << std::endl; // z_class is absent, hence missing
+		if (i == 4) {
+			data << std::endl; // blank lines are ignored
+		}
+	}
+
+	std::stringstream res;
+	std::string warnLog = streamPredict(nlohmann::json::parse(algoStr), nlohmann::json::parse(descStr), nlohmann::json::parse(paramStr), data, res, 3, 2);
+	ASSERT_EQ(0, warnLog.size());
+
+	std::string line;
+	std::vector<Index> expectedNInd = { 3, 3, 3, 1 };
+	for (Index c = 0; c < 4; ++c) {
+		ASSERT_TRUE(bool(std::getline(res, line)));
+		nlohmann::json resChunk = nlohmann::json::parse(line);
+
+		ASSERT_FALSE(resChunk.contains("warnLog"));
+		ASSERT_EQ(c, resChunk["chunk"]["index"].get<Index>());
+		ASSERT_EQ(3 * c, resChunk["chunk"]["firstInd"].get<Index>());
+		ASSERT_EQ(expectedNInd[c], resChunk["chunk"]["nInd"].get<Index>());
+
+		std::vector<Real> zClass = resChunk["variable"]["data"]["z_class"]["completed"]["data"].get<std::vector<Real>>();
+		ASSERT_EQ(expectedNInd[c], zClass.size());
+		for (Index i = 0; i < expectedNInd[c]; ++i) {
+			ASSERT_EQ((3 * c + i) % 2 == 0 ? 1. : 2., zClass[i]); // classes are far apart, classification is certain
+		}
+	}
+	ASSERT_FALSE(bool(std::getline(res, line)));
+}
+
+TEST(streamPredict, invalidLine) {
+	std::stringstream data;
+	data << R"-({"gaussian":"1.0"})-" << std::endl;
+	data << R"-({"gaussian":)-" << std::endl;
+
+	std::stringstream res;
+	std::string warnLog = streamPredict(nlohmann::json::parse(algoStr), nlohmann::json::parse(descStr), nlohmann::json::parse(paramStr), data, res, 1, 1);
+	ASSERT_LT(0, warnLog.size());
+
+	std::string line;
+	ASSERT_TRUE(bool(std::getline(res, line))); // the chunks read before the error are predicted
+	ASSERT_EQ(0, nlohmann::json::parse(line)["chunk"]["index"].get<Index>());
+	ASSERT_FALSE(bool(std::getline(res, line)));
+}
+
+/**
+ * In deterministic mode, the seeds of each chunk are derived from its index, hence the results do not depend on the number of workers.
+ * Absent numeric values are missing.
+ */
+TEST(streamPredict, workerIndependent) {
+	std::string dataStr;
+	for (Index i = 0; i < 20; ++i) {
+		if (i % 5 == 3) {
+			dataStr += "{}\n";
+		} else {
+			dataStr += R"-({"gaussian":)-" + std::to_string(i % 2 == 0 ? -5.0 + 0.1 * i : 5.0 - 0.1 * i) + "}\n";
+		}
+	}
+
+	std::vector<std::string> res(2);
+	std::vector<Index> nWorker = { 1, 4 };
+	for (Index r = 0; r < 2; ++r) {
+		std::stringstream data(dataStr);
+		std::stringstream resStream;
+		std::string warnLog = streamPredict(nlohmann::json::parse(algoStr), nlohmann::json::parse(descStr), nlohmann::json::parse(paramStr), data, resStream, 3,
+				nWorker[r]);
+		ASSERT_EQ(0, warnLog.size());
+
+		std::string line;
+		while (std::getline(resStream, line)) {
+			nlohmann::json resChunk = nlohmann::json::parse(line);
+			ASSERT_FALSE(resChunk.contains("warnLog"));
+			res[r] += resChunk["variable"].dump() + "\n";
+		}
+	}
+
+	ASSERT_EQ(res[0], res[1]);
+
+	std::stringstream resStream(res[0]);
+	std::string line;
+	std::getline(resStream, line);
+	std::getline(resStream, line); // individual 3 is the first of the second chunk
+	std::vector<Real> gaussian = nlohmann::json::parse(line)["data"]["gaussian"]["completed"]["data"].get<std::vector<Real>>();
+	ASSERT_EQ(3, gaussian.size());
+	ASSERT_TRUE(std::isfinite(gaussian[0])); // the absent value is imputed
+}
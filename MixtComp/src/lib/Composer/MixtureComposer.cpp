@@ -125,7 +125,7 @@ std::string MixtureComposer::mStep(const Vector<std::set<Index>>& classInd) {
 
 	std::vector<std::string> vecWarnLog(nVar_);
 
-#pragma omp parallel for // note that this is the only case where parallelism is not performed over observations, but over individuals
+#pragma omp parallel for if (nClass_ < nVar_) // note that this is the only case where parallelism is not performed over observations, but over individuals. With few variables, the threads are left to the mixtures that perform their mStep in parallel over classes.
 	for (Index v = 0; v < nVar_; ++v) {
 		std::string currLog;
 		currLog = v_mixtures_[v]->mStep(classInd); // call mStep on each variable
@@ -260,9 +260,8 @@ int MixtureComposer::nbFreeParameters() const {
 }
 
 void MixtureComposer::sampleUnobservedAndLatent() {
-#pragma omp parallel for
-	for (Index i = 0; i < nInd_; ++i) {
-		sampleUnobservedAndLatent(i);
+	for (MixtIterator it = v_mixtures_.begin(); it != v_mixtures_.end(); ++it) { // each mixture samples all its individuals, in parallel or together
+		(*it)->sampleAllUnobservedAndLatent(zClassInd_.zi().data_);
 	}
 }
 
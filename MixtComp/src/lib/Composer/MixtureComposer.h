@@ -31,6 +31,7 @@
 #include <set>
 #include <vector>
 #include <IO/NamedAlgebra.h>
+#include <IO/OutputSelection.h>
 #include <LinAlg/LinAlg.h>
 #include <Mixture/IMixture.h>
 #include <Param/ConfIntParamStat.h>
@@ -287,16 +288,21 @@ public:
 
 	/**@brief This step can be used to ask each mixture to export its model parameters
 	 * and data
+	 * @param os sections of the output to be exported
 	 **/
 	template<typename Graph>
-	void exportDataParam(Graph& g) const {
+	void exportDataParam(Graph& g, const OutputSelection& os = OutputSelection()) const {
 		g.add_payload( { "variable", "type" }, "z_class", "LatentClass");
 
-		NamedVector<Index> dataCompleted { std::vector<std::string>(), zClassInd_.zi().data_ + minModality };
-		NamedMatrix<Real> dataStat { std::vector<std::string>(), paramName(), tik_ };
+		if (os.completed_) {
+			NamedVector<Index> dataCompleted { std::vector<std::string>(), zClassInd_.zi().data_ + minModality };
+			g.add_payload( { "variable", "data", "z_class" }, "completed", dataCompleted);
+		}
 
-		g.add_payload( { "variable", "data", "z_class" }, "completed", dataCompleted);
-		g.add_payload( { "variable", "data", "z_class" }, "stat", dataStat);
+		if (os.tik_) {
+			NamedMatrix<Real> dataStat { std::vector<std::string>(), paramName(), tik_ };
+			g.add_payload( { "variable", "data", "z_class" }, "stat", dataStat);
+		}
 
 		Index ncol = paramStat_.getStatStorage().cols();
 		std::vector<std::string> colNames;
@@ -305,18 +311,18 @@ public:
 
 		NamedMatrix<Real> paramStat { paramName(), colNames, paramStat_.getStatStorage() };
 
-		Index nObs = paramStat_.getStatStorage().cols();
-		NamedMatrix<Real> paramLog { paramName(), std::vector<std::string>(), paramStat_.getLogStorage() };
-
 		g.add_payload( { "variable", "param", "z_class" }, "stat", paramStat);
-		g.add_payload( { "variable", "param", "z_class" }, "log", paramLog);
+		if (os.paramLog_) {
+			NamedMatrix<Real> paramLog { paramName(), std::vector<std::string>(), paramStat_.getLogStorage() };
+			g.add_payload( { "variable", "param", "z_class" }, "log", paramLog);
+		}
 		g.add_payload( { "variable", "param", "z_class" }, "paramStr", paramStr_);
 
 
 		for (ConstMixtIterator it = v_mixtures_.begin(); it != v_mixtures_.end(); ++it) {
 			std::string currName = (*it)->idName();
 
-			(*it)->exportDataParam();
+			(*it)->exportDataParam(os);
 
 			g.add_payload( { "variable", "type" }, currName, (*it)->modelType());
 		}
@@ -324,10 +330,10 @@ public:
 
 	/**
 	 * Export the mixture part of the output, with model selection, likelihoods, etc... This was the final
-	 * part of the code in mixtCompCluster.cpp
+	 * part of the code in mixtCompCluster.cpp. The diagnostics that are not selected in os are not computed.
 	 */
 	template<typename Graph>
-	void exportMixture(Graph& g) const {
+	void exportMixture(Graph& g, const OutputSelection& os = OutputSelection()) const {
 		std::vector<std::string> dummyNames;
 
 		Index nFreeParameters = nbFreeParameters();
@@ -344,23 +350,31 @@ public:
 		std::cout << "lnObservedLikelihood: " << lnObsLik << std::endl << std::endl;
 #endif
 
-		NamedMatrix<Real> idclass = { paramName(), mixtureName(), Matrix<Real>() };
-		IDClass(idclass.mat_);
-		g.add_payload( { "mixture" }, "IDClass", idclass);
+		if (os.IDClass_) {
+			NamedMatrix<Real> idclass = { paramName(), mixtureName(), Matrix<Real>() };
+			IDClass(idclass.mat_);
+			g.add_payload( { "mixture" }, "IDClass", idclass);
+		}
 
-		NamedMatrix<Real> pGCCPP = { dummyNames, dummyNames, Matrix<Real>() };
-		lnProbaGivenClass(pGCCPP.mat_);
-		g.add_payload( { "mixture" }, "lnProbaGivenClass", pGCCPP);
+		if (os.lnProbaGivenClass_) {
+			NamedMatrix<Real> pGCCPP = { dummyNames, dummyNames, Matrix<Real>() };
+			lnProbaGivenClass(pGCCPP.mat_);
+			g.add_payload( { "mixture" }, "lnProbaGivenClass", pGCCPP);
+		}
 
-		NamedVector<Real> completedProbabilityLogBurnIn = { dummyNames, completedProbabilityLogBurnIn_ };
-		g.add_payload( { "mixture" }, "completedProbabilityLogBurnIn", completedProbabilityLogBurnIn);
+		if (os.completedProbabilityLog_) {
+			NamedVector<Real> completedProbabilityLogBurnIn = { dummyNames, completedProbabilityLogBurnIn_ };
+			g.add_payload( { "mixture" }, "completedProbabilityLogBurnIn", completedProbabilityLogBurnIn);
 
-		NamedVector<Real> completedProbabilityLogRun = { dummyNames, completedProbabilityLogRun_ };
-		g.add_payload( { "mixture" }, "completedProbabilityLogRun", completedProbabilityLogRun);
+			NamedVector<Real> completedProbabilityLogRun = { dummyNames, completedProbabilityLogRun_ };
+			g.add_payload( { "mixture" }, "completedProbabilityLogRun", completedProbabilityLogRun);
+		}
 
-		NamedMatrix<Real> matDelta = { mixtureName(), mixtureName(), Matrix<Real>() };
-		Delta(matDelta.mat_);
-		g.add_payload( { "mixture" }, "delta", matDelta);
+		if (os.delta_) {
+			NamedMatrix<Real> matDelta = { mixtureName(), mixtureName(), Matrix<Real>() };
+			Delta(matDelta.mat_);
+			g.add_payload( { "mixture" }, "delta", matDelta);
+		}
 	}
 
 	/** register a mixture to the composer.
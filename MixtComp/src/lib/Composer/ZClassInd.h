@@ -53,10 +53,15 @@ public:
 		std::string warnLog;
 		std::string paramStr;
 
-		std::vector<std::string> data;
-		g.get_payload({}, "z_class", data);
-
-		warnLog += StringToAugmentedData("z_class", data, zi_, -minModality);
+		if (g.is_numeric_payload( { }, "z_class")) {
+			Vector<Real> data;
+			g.get_payload( { }, "z_class", data);
+			warnLog += NumericToAugmentedData("z_class", data, zi_, -minModality);
+		} else {
+			std::vector<std::string> data;
+			g.get_payload( { }, "z_class", data);
+			warnLog += StringToAugmentedData("z_class", data, zi_, -minModality);
+		}
 
 		for (int k = 0; k < nbClass_; ++k) {
 			classInd_(k).clear();
@@ -23,6 +23,8 @@
 #ifndef LIB_IO_IOFUNCTIONS_H
 #define LIB_IO_IOFUNCTIONS_H
 
+#include <cmath>
+#include <type_traits>
 #include <Data/AugmentedData.h>
 #include <LinAlg/LinAlg.h>
 #include <string>
@@ -71,6 +73,36 @@ std::string StringToAugmentedData(const std::string& idName, const std::vector<s
 	return warnLog;
 }
 
+/**
+ * Numeric counterpart of StringToAugmentedData, used when the Graph provides a numeric column (a numeric or integer vector in R, an
+ * array of numbers in json). No regex parsing is involved. A nan value (NA in R, null in json) is a completely missing value,
+ * other types of missing values can only be described using the string format.
+ */
+template<typename DataType>
+std::string NumericToAugmentedData(const std::string& idName, const Vector<Real>& data, AugmentedData<DataType>& augData, Index offset) {
+	std::string warnLog;
+	typedef typename AugmentedData<DataType>::Type Type;
+	typedef typename AugmentedData<Matrix<Type> >::MisVal MisVal;
+
+	Index nbInd = data.size();
+	augData.resizeArrays(nbInd);
+
+	for (Index i = 0; i < nbInd; ++i) {
+		Real currVal = data(i);
+
+		if (std::isnan(currVal)) {
+			augData.setMissing(i, MisVal(missing_, std::vector<Type>()));
+		} else if (std::is_integral<Type>::value && (currVal != std::floor(currVal) || currVal < 0.)) {
+			std::stringstream sstm;
+			sstm << "In " << idName << ", individual i: " << i << " present an error. " << currVal << " is not a non-negative integer." << std::endl;
+			warnLog += sstm.str();
+		} else {
+			augData.setPresent(i, Type(currVal) + Type(offset));
+		}
+	}
+	return warnLog;
+}
+
 /**
  * Generate column names for quantile based outputs.
  */
@@ -0,0 +1,67 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <IO/OutputSelection.h>
+#include <Various/Constants.h>
+
+namespace mixt {
+
+OutputSelection::OutputSelection() :
+		IDClass_(true), delta_(true), lnProbaGivenClass_(true), completedProbabilityLog_(true), completed_(true), tik_(true), paramLog_(true) {
+}
+
+std::string OutputSelection::set(const std::vector<std::string>& sections) {
+	std::string warnLog;
+
+	IDClass_ = false;
+	delta_ = false;
+	lnProbaGivenClass_ = false;
+	completedProbabilityLog_ = false;
+	completed_ = false;
+	tik_ = false;
+	paramLog_ = false;
+
+	for (std::vector<std::string>::const_iterator it = sections.begin(), itEnd = sections.end(); it != itEnd; ++it) {
+		if (*it == "IDClass") {
+			IDClass_ = true;
+		} else if (*it == "delta") {
+			delta_ = true;
+		} else if (*it == "lnProbaGivenClass") {
+			lnProbaGivenClass_ = true;
+		} else if (*it == "completedProbabilityLog") {
+			completedProbabilityLog_ = true;
+		} else if (*it == "completed") {
+			completed_ = true;
+		} else if (*it == "tik") {
+			tik_ = true;
+		} else if (*it == "paramLog") {
+			paramLog_ = true;
+		} else {
+			warnLog += "Output section " + *it
+					+ " in algo is not recognized. Possible values are: IDClass, delta, lnProbaGivenClass, completedProbabilityLog, completed, tik and paramLog." + eol;
+		}
+	}
+
+	return warnLog;
+}
+
+} // namespace mixt
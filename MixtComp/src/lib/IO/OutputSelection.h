@@ -0,0 +1,71 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_IO_OUTPUTSELECTION_H
+#define LIB_IO_OUTPUTSELECTION_H
+
+#include <string>
+#include <vector>
+
+namespace mixt {
+
+/**
+ * Sections of the output that can be disabled through the optional "output" element of algo. The heavy sections are either
+ * of size nInd (completed data, tik, lnProbaGivenClass), or of size nIter (parameter logs), or are costly to compute
+ * (IDClass and delta). If "output" is not provided, everything is computed and exported. If it is provided, only the
+ * listed sections are, in addition to the parameters and criteria which are always exported.
+ */
+class OutputSelection {
+public:
+	OutputSelection();
+
+	template<typename Graph>
+	std::string set(const Graph& algo) {
+		if (!algo.exist_payload( { }, "output")) {
+			return "";
+		}
+
+		std::vector<std::string> sections;
+		algo.get_payload( { }, "output", sections);
+		return set(sections);
+	}
+
+	std::string set(const std::vector<std::string>& sections);
+
+	bool IDClass_;
+	bool delta_;
+	bool lnProbaGivenClass_;
+	bool completedProbabilityLog_;
+
+	/** completed data of every variable, including the data and time of functional variables */
+	bool completed_;
+
+	/** tik of the latent class */
+	bool tik_;
+
+	/** log of the parameters across the SEM iterations */
+	bool paramLog_;
+};
+
+} // namespace mixt
+
+#endif // LIB_IO_OUTPUTSELECTION_H
@@ -114,7 +114,7 @@ const CwiseBinaryOp<internal::scalar_difference_op<Scalar>, const Derived, const
 /** v = s */
 inline MatrixBase<Derived>&
 operator=(const Scalar& scalar) {
-	(*this) = CwiseNullaryOp<Eigen::internal::scalar_constant_op<Scalar>, Derived>(derived().rows(), derived().cols(), internal::scalar_constant_op < Scalar > (scalar));
+	derived().setConstant(scalar); // a nullary expression typed on Derived ignores the strides of a block in recent versions of Eigen
 	return *this;
 }
 
@@ -34,6 +34,8 @@
 #include <Mixture/Functional/FunctionalMixture.h>
 #include <Mixture/Functional/FunctionalSharedAlphaMixture.h>
 #include <Mixture/Rank/RankMixture.h>
+#include <Mixture/Ordinal/OrdinalMixture.h>
+#include <Mixture/MultivariateGaussian/MultivariateGaussianMixture.h>
 
 namespace mixt {
 
@@ -91,6 +93,14 @@ std::string createAllMixtures(const Graph& algo, const Graph& desc, const Graph&
 				p_mixture = new RankMixture<Graph>(data, param, out, idName, nClass, nInd, confidenceLevel, paramStr);
 			}
 
+			if (idModel == "Ordinal") {
+				p_mixture = new OrdinalMixture<Graph>(data, param, out, idName, nClass, nInd, confidenceLevel, paramStr);
+			}
+
+			if (idModel == "MultivariateGaussian") {
+				p_mixture = new MultivariateGaussianMixture<Graph>(data, param, out, idName, nClass, nInd, confidenceLevel, paramStr);
+			}
+
 			if (p_mixture) {
 				composer.registerMixture(p_mixture);
 			} else {
@@ -35,6 +35,7 @@
 #include <LinAlg/Typedef.h>
 #include <Mixture/Functional/Function.h>
 #include <Mixture/Functional/FunctionalComputation.h>
+#include <Mixture/Functional/FunctionalBatch.h>
 #include <Mixture/Functional/FunctionalClass.h>
 #include <Mixture/Functional/FunctionalParser.h>
 #include <Mixture/Functional/FuncProblem.h>
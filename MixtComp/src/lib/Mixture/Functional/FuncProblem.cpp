@@ -0,0 +1,170 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <Various/Constants.h>
+#include "FuncProblem.h"
+
+namespace mixt {
+
+FuncProblem::FuncProblem(Index nParam, const Vector<Function>& data, const std::set<Index>& setInd) :
+		nParam_(nParam), nSub_(nParam / 2), gradW_(nParam, 0.), evaluated_(false), lastValue_(0.) {
+	Index nTime = 0;
+	for (std::set<Index>::const_iterator it = setInd.begin(), itE = setInd.end(); it != itE; ++it) {
+		nTime += data(*it).nTime();
+	}
+
+	t_.resize(nTime);
+	Index j = 0;
+	for (std::set<Index>::const_iterator it = setInd.begin(), itE = setInd.end(); it != itE; ++it) {
+		const Function& f = data(*it);
+		t_.segment(j, f.nTime()) = f.t();
+		j += f.nTime();
+
+		for (Index i = 0; i < f.nTime(); ++i) {
+			Index s = f.label()(i);
+			gradW_(2 * s) += 1.;
+			gradW_(2 * s + 1) += f.t()(i);
+		}
+	}
+
+	nBlock_ = (nTime + blockSizeOptim - 1) / blockSizeOptim;
+	kappa_.resize(nTime, nSub_);
+	partial_.resize(nBlock_, 1 + nParam_);
+	lastGrad_.resize(nParam_ - 2);
+}
+
+void FuncProblem::evaluate(const TVector& x) {
+	if (evaluated_ && x == lastX_) {
+		return;
+	}
+
+	Index nTime = t_.size();
+
+#pragma omp parallel for
+	for (Index b = 0; b < nBlock_; ++b) {
+		Index first = b * blockSizeOptim;
+		Index last = std::min(first + blockSizeOptim, nTime);
+
+		Real sumLSE = 0.;
+		for (Index p = 0; p < nParam_; ++p) {
+			partial_(b, 1 + p) = 0.;
+		}
+
+		for (Index j = first; j < last; ++j) {
+			Real t = t_(j);
+
+			Real max = 0.; // log value of the first subregression, whose parameters are fixed to 0
+			kappa_(j, 0) = 0.;
+			for (Index s = 1; s < nSub_; ++s) {
+				kappa_(j, s) = x(2 * s - 2) + x(2 * s - 1) * t;
+				max = std::max(max, kappa_(j, s));
+			}
+
+			Real sum = 0.;
+			for (Index s = 0; s < nSub_; ++s) {
+				kappa_(j, s) = std::exp(kappa_(j, s) - max);
+				sum += kappa_(j, s);
+			}
+
+			sumLSE += max + std::log(sum);
+			for (Index s = 0; s < nSub_; ++s) { // derivative of log sum exp, kappa and t * kappa
+				kappa_(j, s) /= sum;
+				partial_(b, 1 + 2 * s) += kappa_(j, s);
+				partial_(b, 2 + 2 * s) += kappa_(j, s) * t;
+			}
+		}
+
+		partial_(b, 0) = sumLSE;
+	}
+
+	Real cost = 0.;
+	for (Index s = 1; s < nSub_; ++s) { // the first two free parameters are left untouched
+		cost += x(2 * s - 2) * gradW_(2 * s) + x(2 * s - 1) * gradW_(2 * s + 1);
+	}
+	for (Index p = 2; p < nParam_; ++p) {
+		lastGrad_(p - 2) = gradW_(p);
+	}
+
+	for (Index b = 0; b < nBlock_; ++b) { // reduction in a fixed order
+		cost -= partial_(b, 0);
+		for (Index p = 2; p < nParam_; ++p) {
+			lastGrad_(p - 2) -= partial_(b, 1 + p);
+		}
+	}
+
+	lastValue_ = -cost; // to perform maximization when minimize is called
+	lastGrad_ *= -1.0;
+	lastX_ = x;
+	evaluated_ = true;
+}
+
+FuncProblem::Scalar FuncProblem::value(const TVector& x) {
+	evaluate(x);
+	return lastValue_;
+}
+
+void FuncProblem::gradient(const TVector& x, TVector& grad) {
+	evaluate(x);
+	grad = lastGrad_;
+}
+
+void FuncProblem::hessian(const TVector& x, THessian& hessian) {
+	evaluate(x);
+
+	Index nTime = t_.size();
+	Index nFreeSub = nSub_ - 1;
+	hessian.resize(2 * nFreeSub, 2 * nFreeSub);
+
+	weightedKappa_ = kappa_.rightCols(nFreeSub);
+	Matrix<Real> cross(nFreeSub, nFreeSub);
+	for (Index m = 0; m < 3; ++m) { // power of t in the derivative, sum of the indices of the two parameters in their subregression
+		if (0 < m) {
+			for (Index j = 0; j < nTime; ++j) {
+				weightedKappa_.row(j) *= t_(j);
+			}
+		}
+
+		cross.noalias() = kappa_.rightCols(nFreeSub).transpose() * weightedKappa_;
+		Vector<Real> diag = weightedKappa_.colwise().sum().transpose();
+
+		for (Index a = 0; a < 2; ++a) {
+			if (m < a || 1 < m - a) {
+				continue;
+			}
+			Index b = m - a;
+
+			for (Index s = 0; s < nFreeSub; ++s) {
+				for (Index r = 0; r < nFreeSub; ++r) {
+					hessian(2 * s + a, 2 * r + b) = ((s == r) ? diag(s) : 0.) - cross(s, r); // opposite of the hessian of the cost, as for the value and gradient
+				}
+			}
+		}
+	}
+}
+
+FuncProblem::Scalar FuncProblem::valueAndGradient(const TVector& x, TVector& grad) {
+	evaluate(x);
+	grad = lastGrad_;
+	return lastValue_;
+}
+
+}
@@ -29,6 +29,7 @@
 #include "cppoptlib/meta.h"
 #include "cppoptlib/problem.h"
 #include "cppoptlib/solver/bfgssolver.h"
+#include "cppoptlib/solver/newtondescentsolver.h"
 
 #include <Mixture/Functional/Function.h>
 
@@ -37,56 +38,61 @@ namespace mixt {
 /**
  * This problem follows the API of cppoptlib. It provides both the value and gradient of the problem to be optimized. The problem is parameterized by the data, hence
  * the references to the data as private members. Code is inspired from old code in optiFunctional
+ *
+ * The cost is sum_j (alpha_{w_j, 0} + alpha_{w_j, 1} * t_j - log(sum_s exp(alpha_{s, 0} + alpha_{s, 1} * t_j))) over all the time steps j of all the individuals
+ * in the class. The first term and its gradient do not depend on the subregression of the other time steps, and are computed once in the constructor. The
+ * time steps are copied contiguously, so that each evaluation is a single pass computing both the log sum exp and its gradient, without any allocation.
+ * The pass is parallelized over blocks of blockSizeOptim time steps, whose partial sums are reduced in a fixed order so that the result does not depend on the
+ * number of threads.
+ *
+ * The hessian is provided for second order solvers. It is computed from the kappa stored during the evaluation: its diagonal blocks only involve sums of
+ * kappa over time, in O(nT x nSub), and its cross terms are obtained as three matrix products kappa^T diag(t^m) kappa, m = 0, 1, 2.
  */
 class FuncProblem: public cppoptlib::Problem<Real> {
 public:
 	using typename cppoptlib::Problem<Real>::Scalar;
 	using typename cppoptlib::Problem<Real>::TVector;
+	using typename cppoptlib::Problem<Real>::THessian;
 
-	FuncProblem(Index nParam, const Vector<Function>& data, const std::set<Index>& setInd) :
-			nParam_(nParam), alphaComplete_(nParam), gradInd_(nParam), data_(data), setInd_(setInd) {
-		alphaComplete_ = 0;
-	}
+	FuncProblem(Index nParam, const Vector<Function>& data, const std::set<Index>& setInd);
 
-	Scalar value(const TVector& x) {
-		Real cost = 0.;
+	Scalar value(const TVector& x);
 
-		for (Index p = 2; p < nParam_; ++p) { // the first two free parameters are left untouched
-			alphaComplete_[p] = x[p - 2];
-		}
+	void gradient(const TVector& x, TVector& grad);
 
-		for (std::set<Index>::const_iterator it = setInd_.begin(), itE = setInd_.end(); it != itE; ++it) { // each individual in current class adds a contribution to both the cost and the gradient of alpha
-			cost += data_(*it).cost(alphaComplete_);
-		}
+	/** Value and gradient computed in the same pass. value and gradient reuse the result if they are called with the same x, as is done in the line search. */
+	Scalar valueAndGradient(const TVector& x, TVector& grad);
 
-		return -cost; // to perform maximization when minimize is called
-	}
+	void hessian(const TVector& x, THessian& hessian);
 
-	void gradient(const TVector& x, TVector& grad) {
-		for (Index p = 0; p < nParam_ - 2; ++p) {
-			grad[p] = 0.;
-		}
+private:
+	/** Compute lastValue_ and lastGrad_ at x, if they have not already been computed at x. */
+	void evaluate(const TVector& x);
 
-		for (Index p = 2; p < nParam_; ++p) { // the first two free parameters are left untouched
-			alphaComplete_[p] = x[p - 2];
-		}
+	Index nParam_;
+	Index nSub_;
 
-		for (std::set<Index>::const_iterator it = setInd_.begin(), itE = setInd_.end(); it != itE; ++it) { // each individual in current class adds a contribution to both the cost and the gradient of alpha
-			data_(*it).grad(alphaComplete_, gradInd_);
-			for (Index p = 0; p < nParam_ - 2; ++p) {
-				grad[p] += gradInd_[p + 2];
-			}
-		}
+	/** Time steps of all the individuals of the class. */
+	Vector<Real> t_;
 
-		grad *= -1.0; // to perform maximization when minimize is called
-	}
+	/** Part of the gradient of the cost that does not depend on alpha: number of time steps and sum of time in each subregression. */
+	Vector<Real> gradW_;
 
-private:
-	Index nParam_;
-	Vector<Real> alphaComplete_;
-	Vector<Real> gradInd_;
-	const Vector<Function>& data_;
-	const std::set<Index>& setInd_;
+	Index nBlock_;
+
+	/** Proportion of each subregression at each time step, for the last evaluated x. */
+	Matrix<Real> kappa_;
+
+	/** Scratch space for the hessian, kappa of the free subregressions weighted by a power of t. */
+	Matrix<Real> weightedKappa_;
+
+	/** Partial sums of each block: sum of log sum exp in column 0, and sum of the derivatives of log sum exp in the following columns. */
+	Matrix<Real> partial_;
+
+	bool evaluated_;
+	TVector lastX_;
+	Real lastValue_;
+	TVector lastGrad_;
 };
 
 }
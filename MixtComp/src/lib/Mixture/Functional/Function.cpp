@@ -25,12 +25,23 @@
 
 namespace mixt {
 
+Function::Function() :
+		nTime_(0), nSub_(0), nCoeffRegStat_(0), nUpdateRegStat_(0) {
+}
+
 void Function::setSize(Index nT, Index nSub) {
 	nTime_ = nT;
 	nSub_ = nSub;
 	t_.resize(nT);
 	x_.resize(nT);
-	w_.resize(nSub);
+	label_.resize(nT);
+	label_ = 0; // all time steps in the first subregression, until removeMissing is called
+	count_.resize(nSub);
+	count_ = 0;
+	if (0 < nSub) {
+		count_(0) = nT;
+	}
+	nCoeffRegStat_ = 0;
 }
 
 void Function::setVal(const Vector<Real>& t, const Vector<Real>& x, const Vector<std::set<Index> >& w) {
@@ -38,99 +49,140 @@ void Function::setVal(const Vector<Real>& t, const Vector<Real>& x, const Vector
 	nSub_ = w.size();
 	t_ = t;
 	x_ = x;
-	w_ = w;
+	label_.resize(nTime_);
+	label_ = 0; // time steps absent from w are put in the first subregression
+	for (Index s = 0; s < nSub_; ++s) {
+		for (std::set<Index>::const_iterator it = w(s).begin(), itE = w(s).end(); it != itE; ++it) {
+			label_(*it) = s;
+		}
+	}
+
+	count_.resize(nSub_);
+	count_ = 0;
+	for (Index i = 0; i < nTime_; ++i) {
+		++count_(label_(i));
+	}
+	nCoeffRegStat_ = 0;
+}
+
+void Function::computeRegStat(Index nCoeff) {
+	if (nCoeffRegStat_ == nCoeff && nUpdateRegStat_ < nTime_) {
+		return;
+	}
+
+	nCoeffRegStat_ = nCoeff;
+	nUpdateRegStat_ = 0;
+	regStat_.resize(nSub_);
+	for (Index s = 0; s < nSub_; ++s) {
+		regStat_(s).setSize(nCoeff);
+	}
+
+	for (Index i = 0; i < nTime_; ++i) {
+		regStat_(label_(i)).add(t_(i), x_(i));
+	}
 }
 
 void Function::setValTime(Index i, Real t, Real x) {
 	t_(i) = t;
 	x_(i) = x;
-}
-
-void Function::computeVandermonde(Index nCoeff) {
-	vandermondeMatrix(t_, nCoeff, vandermonde_);
+	nCoeffRegStat_ = 0;
 }
 
 void Function::computeJointLogProba(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd, Matrix<Real>& jointLogProba) const {
+	Matrix<Real> vandermonde;
+	vandermondeMatrix(t_, beta.cols(), vandermonde);
+
 	jointLogProba.resize(nTime_, nSub_);
-	NormalStatistic normal;
 	Vector<Real> currLogKappa(nSub_);
 	for (Index i = 0; i < nTime_; ++i) {
 		logKappaMatrix(t_(i), alpha, currLogKappa);
 
 		for (Index s = 0; s < nSub_; ++s) {
 			Real logAPriori = currLogKappa(s);
-			Real currExpectation = vandermonde_.row(i).dot(beta.row(s)); // since the completed probability is computed, only the current subregression is taken into account in the computation
-			Real logAPosteriori = normal.lpdf(x_(i), currExpectation, sd(s));
+			Real currExpectation = vandermonde.row(i).dot(beta.row(s)); // since the completed probability is computed, only the current subregression is taken into account in the computation
+			Real logAPosteriori = normal_.lpdf(x_(i), currExpectation, sd(s));
 			jointLogProba(i, s) = logAPriori + logAPosteriori;
 		}
 	}
 }
 
-
-Real Function::lnCompletedProbability(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) const {
+Real Function::lnCompletedProbability(const Matrix<Real>& jointLogProba, Index offset, Index firstCol) const {
 	Real logProba = 0.;
 
-	Matrix<Real> jointLogProba;
-	computeJointLogProba(alpha, beta, sd, jointLogProba);
-	for (Index s = 0; s < nSub_; ++s) {
-		for (std::set<Index>::const_iterator it = w_(s).begin(), itE = w_(s).end(); it != itE; ++it) {
-			logProba += jointLogProba(*it, s); // only the completed value of w is taken into account
-		}
+	for (Index i = 0; i < nTime_; ++i) {
+		logProba += jointLogProba(offset + i, firstCol + label_(i)); // only the completed value of w is taken into account
 	}
 
 	return logProba;
 }
 
-Real Function::lnObservedProbability(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) const {
+Real Function::lnObservedProbability(const Matrix<Real>& jointLogProba, Index offset, Index firstCol) const {
 	Real logProba = 0.;
 
-	Matrix<Real> jointLogProba;
-	computeJointLogProba(alpha, beta, sd, jointLogProba);
+	Vector<Real> dummy(nSub_);
 	for (Index i = 0; i < nTime_; ++i) {
-		Vector<Real> dummy;
-		logProba += dummy.logToMulti(jointLogProba.row(i)); // every possible value of w is taken into account, to marginalize over w
+		logProba += dummy.logToMulti(jointLogProba.row(offset + i).segment(firstCol, nSub_)); // every possible value of w is taken into account, to marginalize over w
 	}
 
 	return logProba;
 }
 
-void Function::sampleWNoCheck(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) {
-	Matrix<Real> jointLogProba;
-	computeJointLogProba(alpha, beta, sd, jointLogProba);
-
-	for (Index s = 0; s < nSub_; ++s) {
-		w_(s).clear();
-	}
+void Function::sampleWNoCheck(const Matrix<Real>& jointLogProba, Index offset, Index firstCol) {
+	count_ = 0;
 
-	Vector<Real> currProba;
+	Vector<Real> currProba(nSub_);
 	for (Index i = 0; i < nTime_; ++i) {
-		currProba.logToMulti(jointLogProba.row(i));
-		w_(multi_.sample(currProba)).insert(i);
+		currProba.logToMulti(jointLogProba.row(offset + i).segment(firstCol, nSub_));
+		Index currW = multi_.sample(currProba);
+		if (0 < nCoeffRegStat_ && currW != label_(i)) { // only the time steps that changed subregression are moved in the regression statistics
+			regStat_(label_(i)).remove(t_(i), x_(i));
+			regStat_(currW).add(t_(i), x_(i));
+			++nUpdateRegStat_;
+		}
+		label_(i) = currW;
+		++count_(currW);
 	}
 }
 
+Real Function::lnCompletedProbability(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) const {
+	Matrix<Real> jointLogProba;
+	computeJointLogProba(alpha, beta, sd, jointLogProba);
+	return lnCompletedProbability(jointLogProba, 0, 0);
+}
+
+Real Function::lnObservedProbability(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) const {
+	Matrix<Real> jointLogProba;
+	computeJointLogProba(alpha, beta, sd, jointLogProba);
+	return lnObservedProbability(jointLogProba, 0, 0);
+}
+
+void Function::sampleWNoCheck(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd) {
+	Matrix<Real> jointLogProba;
+	computeJointLogProba(alpha, beta, sd, jointLogProba);
+	sampleWNoCheck(jointLogProba, 0, 0);
+}
 
 void Function::removeMissingUniformSampling() {
-	for (Index s = 0; s < nSub_; ++s) { // clearing is necessary, as removeMissing will be called at several points during the run
-		w_(s).clear();
-	}
+	count_ = 0; // reset is necessary, as removeMissing will be called at several points during the run
+	nCoeffRegStat_ = 0; // all labels are reset, the regression statistics will be recomputed from scratch
 
 	for (Index i = 0; i < nTime_; ++i) {
-		w_(multi_.sampleInt(0, nSub_ - 1)).insert(i); // w follows a uniform discrete law
+		label_(i) = multi_.sampleInt(0, nSub_ - 1); // w follows a uniform discrete law
+		++count_(label_(i));
 	}
 }
 
 void Function::removeMissingQuantile(const Vector<Real>& quantiles) {
 	Index nQuantile = quantiles.size();
-	for (Index s = 0; s < nSub_; ++s) { // clearing is necessary, as removeMissing will be called at several points during the run
-		w_(s).clear();
-	}
+	count_ = 0; // reset is necessary, as removeMissing will be called at several points during the run
+	nCoeffRegStat_ = 0; // all labels are reset, the regression statistics will be recomputed from scratch
 
 	for (Index i = 0; i < nTime_; ++i) {
 		Real currT = t_(i);
 		for (Index q = 1; q < nQuantile; ++q) {
 			if (currT <= quantiles(q)) {
-				w_(q - 1).insert(i);
+				label_(i) = q - 1;
+				++count_(q - 1);
 				break;
 			}
 		}
@@ -138,9 +190,8 @@ void Function::removeMissingQuantile(const Vector<Real>& quantiles) {
 }
 
 void Function::removeMissingQuantileMixing(const Vector<Real>& quantiles) {
-	for (Index s = 0; s < nSub_; ++s) { // clearing is necessary, as removeMissing will be called at several points during the run
-		w_(s).clear();
-	}
+	count_ = 0; // reset is necessary, as removeMissing will be called at several points during the run
+	nCoeffRegStat_ = 0; // all labels are reset, the regression statistics will be recomputed from scratch
 
 	Vector<Real> midPoints(nSub_);
 	Vector<Real> proba(nSub_);
@@ -169,7 +220,8 @@ void Function::removeMissingQuantileMixing(const Vector<Real>& quantiles) {
 		}
 
 		Index currW = multi_.sample(proba);
-		w_(currW).insert(i);
+		label_(i) = currW;
+		++count_(currW);
 	}
 }
 
@@ -182,9 +234,9 @@ Real Function::costAndGrad(const Vector<Real>& alpha, Vector<Real>& grad) const
 
 	timeValue(t_, nParam, alpha, logValue, logSumExpValue);
 
-	costFunction(t_, logValue, logSumExpValue, w_, cost);
+	costFunction(t_, logValue, logSumExpValue, label_, cost);
 
-	gradCostFunction(t_, logValue, logSumExpValue, w_, grad);
+	gradCostFunction(t_, logValue, logSumExpValue, label_, grad);
 
 	return cost;
 }
@@ -198,7 +250,7 @@ Real Function::cost(const Vector<Real>& alpha) const {
 
 	timeValue(t_, nParam, alpha, logValue, logSumExpValue);
 
-	costFunction(t_, logValue, logSumExpValue, w_, cost);
+	costFunction(t_, logValue, logSumExpValue, label_, cost);
 
 	return cost;
 }
@@ -211,14 +263,14 @@ void Function::grad(const Vector<Real>& alpha, Vector<Real>& grad) const {
 
 	timeValue(t_, nParam, alpha, logValue, logSumExpValue);
 
-	gradCostFunction(t_, logValue, logSumExpValue, w_, grad);
+	gradCostFunction(t_, logValue, logSumExpValue, label_, grad);
 }
 
 void Function::printProp() const {
 	Vector<Real> prop(nSub_, 0.);
 
 	for (Index s = 0; s < nSub_; ++s) {
-		prop(s) = w_(s).size();
+		prop(s) = count_(s);
 	}
 
 	prop = prop / prop.sum();
@@ -250,8 +302,10 @@ void Function::printSubRegT() const {
 #ifdef MC_VERBOSE
 	for (Index w = 0; w < nSub_; ++w) {
 		std::cout << "w: " << w << ": ";
-		for (std::set<Index>::const_iterator it = w_(w).begin(), itEnd = w_(w).end(); it != itEnd; ++it) {
-			std::cout << t_(*it) << ", ";
+		for (Index i = 0; i < nTime_; ++i) {
+			if (label_(i) == w) {
+				std::cout << t_(i) << ", ";
+			}
 		}
 		std::cout << std::endl;
 	}
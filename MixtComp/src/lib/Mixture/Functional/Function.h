@@ -26,11 +26,14 @@
 #include <LinAlg/LinAlg.h>
 #include "Statistic/Statistic.h"
 #include "FunctionalComputation.h"
+#include "RegStat.h"
 
 namespace mixt {
 
 class Function {
 public:
+	Function();
+
 	void setSize(Index nT, Index nSub);
 
 	/** Set all internal values, useful for unit testing */
@@ -38,8 +41,6 @@ public:
 
 	void setValTime(Index i, Real t, Real x);
 
-	void computeVandermonde(Index nCoeff);
-
 	/**
 	 * Similar to lnObservedProbability, except that there is no summation over all possible
 	 * values of w. Only the completed value is considered.
@@ -50,6 +51,18 @@ public:
 
 	void sampleWNoCheck(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd);
 
+	/**
+	 * Same as the versions taking the parameters as arguments, except that the joint log proba of this individual is read in a batch
+	 * computed for all individuals and all classes, see FunctionalBatch::jointLogProba.
+	 * @param offset first row of the individual in the batch
+	 * @param firstCol column of the first subregression of the class in the batch
+	 */
+	Real lnCompletedProbability(const Matrix<Real>& jointLogProba, Index offset, Index firstCol) const;
+
+	Real lnObservedProbability(const Matrix<Real>& jointLogProba, Index offset, Index firstCol) const;
+
+	void sampleWNoCheck(const Matrix<Real>& jointLogProba, Index offset, Index firstCol);
+
 	void removeMissingUniformSampling();
 
 	void removeMissingQuantile(const Vector<Real>& quantiles);
@@ -74,12 +87,28 @@ public:
 	const Vector<Real>& x() const {
 		return x_;
 	}
-	const Vector<std::set<Index> >& w() const {
-		return w_;
+
+	/** Subregression of each time step. */
+	const Vector<Index>& label() const {
+		return label_;
 	}
 
-	const Matrix<Real>& vandermonde() const {
-		return vandermonde_;
+	/** Number of time steps in each subregression. */
+	const Vector<Index>& count() const {
+		return count_;
+	}
+
+	/**
+	 * Make the sufficient statistics of the regression of each subregression available for nCoeff coefficients. They are
+	 * computed from scratch only if the labels have been globally reset since the last call, or if nTime time steps have been moved
+	 * since they were last computed, so that the rounding errors of the updates do not accumulate. They are otherwise kept up to
+	 * date by sampleWNoCheck, which only updates the time steps that changed subregression.
+	 */
+	void computeRegStat(Index nCoeff);
+
+	/** Regression statistics of the time steps in subregression s. Valid after computeRegStat. */
+	const RegStat& regStat(Index s) const {
+		return regStat_(s);
 	}
 
 	void printProp() const;
@@ -105,12 +134,12 @@ public:
 	void printSubRegT() const;
 
 	/**
-	 * Computes the joint proba, which can be used for both the completed and observed probability computation.
+	 * Computes the joint proba, which can be used for both the completed and observed probability computation. In a mixture, all
+	 * individuals are evaluated at once by FunctionalBatch::jointLogProba, this version is used for isolated individuals.
 	 * @return jointLogProba(i, s) where i is an individual, and s a subregression. jointLogProba(i, s) is log(p(x, w))
 	 * */
 	void computeJointLogProba(const Matrix<Real>& alpha, const Matrix<Real>& beta, const Vector<Real>& sd, Matrix<Real>& jointLogProba) const;
 
-
 private:
 	Index nTime_;
 	Index nSub_;
@@ -122,11 +151,19 @@ private:
 	Vector<Real> x_;
 
 	/** Subregression to which each time step belong. Has same size as t_. */
-	Vector<std::set<Index> > w_;
+	Vector<Index> label_;
+
+	/** Number of time steps in each subregression. Has size nSub_. */
+	Vector<Index> count_;
+
+	/** Number of coefficients of the regression statistics, 0 if they are outdated. */
+	Index nCoeffRegStat_;
+
+	/** Number of time steps moved by sampleWNoCheck since the regression statistics were computed from scratch. */
+	Index nUpdateRegStat_;
 
-	/** Vandermonde matrix, to be computed once and for all as soon as data is known, for example just after a setData. Rows are time steps,
-	 * and columns are coefficients in the regression. */
-	Matrix<Real> vandermonde_;
+	/** One element per subregression. */
+	Vector<RegStat> regStat_;
 
 	NormalStatistic normal_;
 	MultinomialStatistic multi_;
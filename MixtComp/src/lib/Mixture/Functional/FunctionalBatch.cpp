@@ -0,0 +1,141 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <algorithm>
+
+#include <Various/Constants.h>
+#include "FunctionalBatch.h"
+#include "FunctionalClass.h"
+#include "FunctionalComputation.h"
+
+namespace mixt {
+
+void FunctionalBatch::set(const Vector<Function>& data, Index nCoeff) {
+	Index nInd = data.size();
+
+	offset_.resize(nInd + 1);
+	offset_(0) = 0;
+	for (Index i = 0; i < nInd; ++i) {
+		offset_(i + 1) = offset_(i) + data(i).nTime();
+	}
+
+	x_.resize(offset_(nInd));
+	std::vector<Real> sortedT;
+	sortedT.reserve(offset_(nInd));
+	for (Index i = 0; i < nInd; ++i) {
+		x_.segment(offset_(i), data(i).nTime()) = data(i).x();
+		sortedT.insert(sortedT.end(), data(i).t().begin(), data(i).t().end());
+	}
+
+	std::sort(sortedT.begin(), sortedT.end());
+	sortedT.erase(std::unique(sortedT.begin(), sortedT.end()), sortedT.end());
+	uniqueT_.resize(sortedT.size());
+	std::copy(sortedT.begin(), sortedT.end(), uniqueT_.begin());
+
+	timeIndex_.resize(offset_(nInd));
+	for (Index i = 0; i < nInd; ++i) {
+		for (Index j = 0; j < data(i).nTime(); ++j) {
+			timeIndex_(offset_(i) + j) = std::lower_bound(sortedT.begin(), sortedT.end(), data(i).t()(j)) - sortedT.begin();
+		}
+	}
+
+	vandermondeMatrix(uniqueT_, nCoeff, vandermonde_);
+
+	cacheVersion_.clear();
+	kappaAlpha_.resize(0, 0);
+}
+
+void FunctionalBatch::refresh(const std::vector<FunctionalClass>& classes) {
+	Index nClass = classes.size();
+	if (cacheVersion_.size() != nClass) {
+		cacheVersion_.assign(nClass, 0);
+		jointLogProba_.resize(x_.size(), nClass * classes[0].beta().rows());
+	}
+
+	std::vector<Index> outdated;
+	for (Index k = 0; k < nClass; ++k) {
+		if (cacheVersion_[k] != classes[k].paramVersion()) {
+			outdated.push_back(k);
+		}
+	}
+
+	if (outdated.size() > 0) {
+		computeJointLogProba(classes, outdated);
+	}
+}
+
+bool FunctionalBatch::isUpToDate(const std::vector<FunctionalClass>& classes, Index k) const {
+	return k < cacheVersion_.size() && cacheVersion_[k] == classes[k].paramVersion();
+}
+
+void FunctionalBatch::computeJointLogProba(const std::vector<FunctionalClass>& classes, const std::vector<Index>& outdated) {
+	Index nSub = classes[0].beta().rows();
+	Index nCoeff = classes[0].beta().cols();
+	Index nTime = x_.size();
+
+	Matrix<Real> beta(nCoeff, outdated.size() * nSub);
+	for (Index o = 0; o < outdated.size(); ++o) {
+		beta.middleCols(o * nSub, nSub) = classes[outdated[o]].beta().transpose();
+	}
+
+	Matrix<Real> expectation(uniqueT_.size(), outdated.size() * nSub);
+	expectation.noalias() = vandermonde_ * beta; // a single product for all the outdated classes
+
+	for (Index o = 0; o < outdated.size(); ++o) {
+		Index k = outdated[o];
+		const Matrix<Real>& alpha = classes[k].alpha();
+		const Vector<Real>& sd = classes[k].sd();
+
+		if (kappaAlpha_.rows() != alpha.rows() || kappaAlpha_ != alpha) { // log kappa only depends on alpha
+			computeLogKappa(alpha);
+		}
+
+		for (Index s = 0; s < nSub; ++s) {
+			Real logNormConst = - std::log(sd(s)) - l2pi;
+			Real invSd = 1. / sd(s);
+			for (Index i = 0; i < nTime; ++i) {
+				Index u = timeIndex_(i);
+				Real zScore = (x_(i) - expectation(u, o * nSub + s)) * invSd;
+				jointLogProba_(i, k * nSub + s) = logKappa_(u, s) + logNormConst - 0.5 * zScore * zScore;
+			}
+		}
+
+		cacheVersion_[k] = classes[k].paramVersion();
+	}
+}
+
+void FunctionalBatch::computeLogKappa(const Matrix<Real>& alpha) {
+	Index nSub = alpha.rows();
+	logKappa_.resize(uniqueT_.size(), nSub);
+
+	for (Index s = 0; s < nSub; ++s) { // log of the unnormalized kappa, see logKappaMatrix
+		logKappa_.col(s) = alpha(s, 0) + alpha(s, 1) * uniqueT_.array();
+	}
+
+	Vector<Real> max = logKappa_.rowwise().maxCoeff();
+	Vector<Real> logSum = (max.array() + (logKappa_.colwise() - max).array().exp().rowwise().sum().log()).matrix();
+	logKappa_.colwise() -= logSum;
+
+	kappaAlpha_ = alpha;
+}
+
+} // namespace mixt
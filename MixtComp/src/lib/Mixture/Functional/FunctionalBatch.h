@@ -0,0 +1,129 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef FUNCTIONALBATCH
+#define FUNCTIONALBATCH
+
+#include <vector>
+
+#include <LinAlg/LinAlg.h>
+#include "Function.h"
+
+namespace mixt {
+
+class FunctionalClass;
+
+/**
+ * All the time steps of all the individuals of a functional variable, packed contiguously so that computations involving every
+ * individual are performed as a few large matrix operations instead of many small ones. The time steps of individual i are the rows
+ * offset(i) to offset(i) + nTime - 1.
+ *
+ * The distinct time values are stored once, so that the Vandermonde matrix, the expectations and kappa are computed per distinct time
+ * instead of per time step. When the individuals are sampled on a common grid, their cost does not depend on the number of individuals.
+ */
+class FunctionalBatch {
+public:
+	/**
+	 * Pack the time steps and values of all the individuals, and compute the Vandermonde matrix of the distinct time values. Must be
+	 * called again if data is modified.
+	 */
+	void set(const Vector<Function>& data, Index nCoeff);
+
+	Index offset(Index i) const {
+		return offset_(i);
+	}
+
+	/** Total number of time steps, over all individuals. */
+	Index nTime() const {
+		return x_.size();
+	}
+
+	/** Number of distinct time values, over all individuals. */
+	Index nUniqueTime() const {
+		return uniqueT_.size();
+	}
+
+	/** Index in the distinct time values of each packed time step. */
+	const Vector<Index>& timeIndex() const {
+		return timeIndex_;
+	}
+
+	/** Rows are distinct time values, columns are coefficients in the regression. */
+	const Matrix<Real>& vandermonde() const {
+		return vandermonde_;
+	}
+
+	/**
+	 * Compute the columns of jointLogProba of the classes whose parameters have been modified since the last call, as indicated by
+	 * FunctionalClass::paramVersion. The expectations are computed for all the outdated classes in a single product between the
+	 * Vandermonde matrix and the concatenated beta, and log kappa is computed for each distinct time value, then the normal log density is
+	 * applied to each time step. Must be called serially, after each modification of the parameters.
+	 */
+	void refresh(const std::vector<FunctionalClass>& classes);
+
+	/** True if the columns of class k in jointLogProba have been computed with the current parameters of the class. */
+	bool isUpToDate(const std::vector<FunctionalClass>& classes, Index k) const;
+
+	/**
+	 * Joint log proba log(p(x, w)) of every time step for every subregression of every class: row offset(i) + t and column k * nSub + s.
+	 * Only the columns of the classes for which isUpToDate is true can be used.
+	 */
+	const Matrix<Real>& jointLogProba() const {
+		return jointLogProba_;
+	}
+
+private:
+	/** Compute the columns of jointLogProba_ corresponding to the outdated classes. */
+	void computeJointLogProba(const std::vector<FunctionalClass>& classes, const std::vector<Index>& outdated);
+
+	/** Compute logKappa_ for alpha. */
+	void computeLogKappa(const Matrix<Real>& alpha);
+
+	/** First packed row of each individual, with an additional last element equal to the total number of time steps. */
+	Vector<Index> offset_;
+
+	Vector<Real> x_;
+
+	/** Distinct time values, sorted. */
+	Vector<Real> uniqueT_;
+
+	Vector<Index> timeIndex_;
+
+	Matrix<Real> vandermonde_;
+
+	Matrix<Real> jointLogProba_;
+
+	/**
+	 * Normalized log kappa of each distinct time value, for the alpha in kappaAlpha_. In FunctionalSharedAlphaMixture all classes have
+	 * the same alpha, so that it is computed once each time alpha is estimated, and reused for every class.
+	 */
+	Matrix<Real> logKappa_;
+
+	Matrix<Real> kappaAlpha_;
+
+	/** Version of the parameters of each class used to compute jointLogProba_, 0 if it has never been computed. */
+	std::vector<Index> cacheVersion_;
+};
+
+} // namespace mixt
+
+#endif // FUNCTIONALBATCH
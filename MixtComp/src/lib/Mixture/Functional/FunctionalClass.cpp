@@ -20,13 +20,22 @@
  *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
+#include <atomic>
+
 #include "FuncProblem.h"
 #include "FunctionalClass.h"
 
 namespace mixt {
 
+namespace {
+
+/** Last version attributed, 0 is never attributed and denotes an empty cache in FunctionalBatch. */
+std::atomic<Index> lastParamVersion(0);
+
+}
+
 FunctionalClass::FunctionalClass(Vector<Function>& data, Real confidenceLevel) :
-		nSub_(0), nCoeff_(0), data_(data), alphaParamStat_(alpha_, confidenceLevel), betaParamStat_(beta_, confidenceLevel), sdParamStat_(sd_, confidenceLevel) {
+		paramVersion_(0), nSub_(0), nCoeff_(0), optim_(BFGS_), data_(data), alphaParamStat_(alpha_, confidenceLevel), betaParamStat_(beta_, confidenceLevel), sdParamStat_(sd_, confidenceLevel) {
 }
 
 void FunctionalClass::setSize(Index nSub, Index nCoeff) {
@@ -40,6 +49,11 @@ void FunctionalClass::setSize(Index nSub, Index nCoeff) {
 	alpha_ = 0.; // initialization is mandatory as the optimization is an iterative process
 	beta_ = 0.;
 	sd_ = 0.;
+	updateParamVersion();
+}
+
+void FunctionalClass::updateParamVersion() {
+	paramVersion_ = ++lastParamVersion;
 }
 
 std::string FunctionalClass::mStep(const std::set<Index>& setInd) {
@@ -64,46 +78,49 @@ void FunctionalClass::mStepAlpha(const std::set<Index>& setInd) {
 
 	FuncProblem fp(nParam, data_, setInd);
 
-	cppoptlib::BfgsSolver<FuncProblem> solver;
 	cppoptlib::Criteria<Real> crit = cppoptlib::Criteria<Real>::defaults(); // Create a Criteria class to set the solver's stop conditions
 	crit.iterations = maxIterationOptim;
-	solver.setStopCriteria(crit);
 
-	solver.minimize(fp, alpha);
+	if (optim_ == Newton_) { // the current alpha is used as a starting point, which is close to the optimum after the first iterations of the SEM
+		cppoptlib::NewtonDescentSolver<FuncProblem> solver;
+		solver.setStopCriteria(crit);
+		solver.minimize(fp, alpha);
+	} else {
+		cppoptlib::BfgsSolver<FuncProblem> solver;
+		solver.setStopCriteria(crit);
+		solver.minimize(fp, alpha);
+	}
 
 	for (Index s = 0; s < nSub - 1; ++s) { // from linear to matrix format
 		alpha_(s + 1, 0) = alpha[2 * s];
 		alpha_(s + 1, 1) = alpha[2 * s + 1];
 	}
+
+	updateParamVersion();
 }
 
 std::string FunctionalClass::mStepBetaSd(const std::set<Index>& setInd) {
 	std::string warnLog;
-	Vector<Index> nTTotal(nSub_, 0);
 
-	for (std::set<Index>::const_iterator itData = setInd.begin(), itDataE = setInd.end(); itData != itDataE; ++itData) { // to create the complete design matrix and y for the class, the total number of timesteps over the class must be determined
+	regStat_.resize(nSub_);
+	for (Index s = 0; s < nSub_; ++s) {
+		regStat_(s).setSize(nCoeff_);
+	}
+
+	for (std::set<Index>::const_iterator itData = setInd.begin(), itDataE = setInd.end(); itData != itDataE; ++itData) {
+		Function& f = data_(*itData);
+		f.computeRegStat(nCoeff_); // only recomputed if the labels have been reset, or enough time steps moved, since the last call
 		for (Index s = 0; s < nSub_; ++s) {
-			nTTotal(s) += data_(*itData).w()(s).size();
+			regStat_(s).merge(f.regStat(s));
 		}
 	}
 
-	Vector<Matrix<Real> > design(nSub_);
-	Vector<Vector<Real> > y(nSub_);
 	for (Index s = 0; s < nSub_; ++s) {
-		design(s).resize(nTTotal(s), nCoeff_);
-		y(s).resize(nTTotal(s));
-
-		Index i = 0; // current row in the global design matrix
-		for (std::set<Index>::const_iterator itData = setInd.begin(), itDataE = setInd.end(); itData != itDataE; ++itData) {
-			for (std::set<Index>::const_iterator itTime = data_(*itData).w()(s).begin(), itTimeE = data_(*itData).w()(s).end(); itTime != itTimeE; ++itTime) {
-				design(s).row(i) = data_(*itData).vandermonde().row(*itTime);
-				y(s)(i) = data_(*itData).x()(*itTime);
-				++i;
-			}
-		}
+		Real rss;
+		regStat_(s).regression(beta_.row(s), rss);
+		sd_(s) = std::sqrt(rss / regStat_(s).n());
 	}
-
-	subRegression(design, y, beta_, sd_);
+	updateParamVersion();
 
 	if (sd_.minCoeff() < epsilon) { // at least one coefficient is too small
 		warnLog += "At least one sub regression has a standard deviation less than the minimal accepted value: " + epsilonStr + eol;
@@ -114,6 +131,7 @@ std::string FunctionalClass::mStepBetaSd(const std::set<Index>& setInd) {
 
 void FunctionalClass::initParam() {
 	alpha_ = 0.;
+	updateParamVersion();
 }
 
 void FunctionalClass::setParamStorage() {
@@ -126,6 +144,7 @@ void FunctionalClass::setExpectationParam() {
 	alphaParamStat_.setExpectationParam();
 	betaParamStat_.setExpectationParam();
 	sdParamStat_.setExpectationParam();
+	updateParamVersion();
 }
 
 void FunctionalClass::sampleParam(Index iteration, Index iterationMax) {
@@ -146,16 +165,17 @@ std::string FunctionalClass::checkSampleCondition(const std::set<Index>& setInd)
 }
 
 bool FunctionalClass::checkNbDifferentValue(const std::set<Index>& setInd) const {
-	for (Index s = 0; s < nSub_; ++s) {
-		std::list<Real> listT;
+	Vector<std::list<Real> > listT(nSub_);
 
-		for (std::set<Index>::const_iterator it = setInd.begin(), itE = setInd.end(); it != itE; ++it) { // only loop on individuals in the current class
-			for (std::set<Index>::const_iterator itW = data_(*it).w()(s).begin(), itWE = data_(*it).w()(s).end(); itW != itWE; ++itW) { // only loop on timesteps in the current subregression
-				listT.push_back(data_(*it).t()(*itW));
-			}
+	for (std::set<Index>::const_iterator it = setInd.begin(), itE = setInd.end(); it != itE; ++it) { // only loop on individuals in the current class
+		const Function& f = data_(*it);
+		for (Index i = 0; i < f.nTime(); ++i) {
+			listT(f.label()(i)).push_back(f.t()(i));
 		}
+	}
 
-		if (!differentValue(listT, nCoeff_, epsilon)) {
+	for (Index s = 0; s < nSub_; ++s) {
+		if (!differentValue(listT(s), nCoeff_, epsilon)) {
 			return false;
 		}
 	}
@@ -26,7 +26,9 @@
 #include <LinAlg/LinAlg.h>
 #include <Mixture/Functional/Function.h>
 #include <Param/ConfIntParamStat.h>
+#include <Various/Enum.h>
 #include "FunctionalComputation.h"
+#include "RegStat.h"
 
 namespace mixt {
 
@@ -36,11 +38,17 @@ public:
 
 	void setSize(Index nSub, Index nCoeff);
 
+	/** Solver used to estimate alpha in mStepAlpha, BFGS by default. */
+	void setOptim(OptimType optim) {
+		optim_ = optim;
+	}
+
 	template<typename MatrixType, typename VectorType>
 	void setParam(const MatrixType& alpha, const MatrixType& beta, const VectorType& sd) {
 		alpha_ = alpha;
 		beta_ = beta;
 		sd_ = sd;
+		updateParamVersion();
 	}
 
 	std::string mStep(const std::set<Index>& setInd);
@@ -94,12 +102,27 @@ public:
 
 	void setAlpha(const Matrix<Real>& alpha) {
 		alpha_ = alpha;
+		updateParamVersion();
+	}
+
+	/**
+	 * Identifier of the current values of alpha_, beta_ and sd_, different each time they are modified, and unique among all the
+	 * FunctionalClass objects. It is used to invalidate the joint log proba cached in FunctionalBatch.
+	 */
+	Index paramVersion() const {
+		return paramVersion_;
 	}
 private:
+	void updateParamVersion();
+
+	Index paramVersion_;
+
 	Index nSub_;
 
 	Index nCoeff_;
 
+	OptimType optim_;
+
 	/** Data, not const because sampling has to occur at some point */
 	Vector<Function>& data_;
 
@@ -112,6 +135,9 @@ private:
 	/** One coefficient per sub-regression */
 	Vector<Real> sd_;
 
+	/** Regression statistics of each sub-regression, merged over the individuals of the class in mStepBetaSd. */
+	Vector<RegStat> regStat_;
+
 	/** Contrarily to what is done in the Rank model for example, here the parameter estimation is done
 	 * directly inside class. */
 	ConfIntParamStat<Matrix<Real> > alphaParamStat_;
@@ -70,15 +70,13 @@ void timeValue(const Vector<Real>& t, Index nParam, const Vector<Real>& alpha, M
 	}
 }
 
-void costFunction(const Vector<Real>& t, const Matrix<Real>& logValue, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Real& cost) {
+void costFunction(const Vector<Real>& t, const Matrix<Real>& logValue, const Vector<Real>& logSumExpValue, const Vector<Index>& label, Real& cost) {
 	cost = 0.;
-	Index nSub = w.size(); // number of subregressions
+	Index nT = t.size();
 
-	for (Index s = 0; s < nSub; ++s) {
-		for (std::set<Index>::const_iterator it = w(s).begin(), ite = w(s).end(); it != ite; ++it) {
-			cost += logValue(*it, s);
-			cost += -logSumExpValue(*it);
-		}
+	for (Index j = 0; j < nT; ++j) {
+		cost += logValue(j, label(j));
+		cost += -logSumExpValue(j);
 	}
 }
 
@@ -102,31 +100,32 @@ Real deriv2Var(Index subReg0, Index subRegInd0, Index subReg1, Index subRegInd1,
 	return res;
 }
 
-void gradCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Vector<Real>& gradCost) {
+void gradCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<Index>& label, Vector<Real>& gradCost) {
 	Index nT = t.size();
 	Index nParam = 2 * value.cols();
 
+	Vector<Real> addComp(nParam, 0.); // numerator terms, which only depend on the subregressions of the time steps
+	for (Index j = 0; j < nT; ++j) {
+		addComp(2 * label(j)) += 1.;
+		addComp(2 * label(j) + 1) += t(j);
+	}
+
 	for (Index p = 0; p < nParam; ++p) { // currently computed coefficient in the gradient
 		Index subReg = p / 2; // current alpha index
 		Index subRegInd = p % 2; // 0 or 1, indicating which alpha among the pair in varDeriv
 
-		Real addComp = 0.;
 		Real divComp = 0.;
-		for (std::set<Index>::const_iterator it = w(subReg).begin(), ite = w(subReg).end(); it != ite; ++it) {
-			addComp += subRegInd ? t(*it) : 1.;
-		}
-
 		for (Index j = 0; j < nT; ++j) { // denominator term does not depend on lambda, and there is one term per timestep
 			Real u = std::exp(logSumExpValue(j));
 			Real u0 = deriv1Var(subReg, subRegInd, j, t, value);
 			divComp += -u0 / u;
 		}
 
-		gradCost[p] = addComp + divComp;
+		gradCost[p] = addComp(p) + divComp;
 	}
 }
 
-void hessianCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Matrix<Real>& hessianCost) {
+void hessianCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, Matrix<Real>& hessianCost) {
 	Index nT = t.size();
 	Index nParam = 2 * value.cols();
 	hessianCost.resize(nParam, nParam);
@@ -157,7 +156,7 @@ void hessianCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const
 	}
 }
 
-void hessianCostFunctionNoSym(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::list<Index> >& w, Matrix<Real>& hessianCost) {
+void hessianCostFunctionNoSym(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, Matrix<Real>& hessianCost) {
 	Index nT = t.size();
 	Index nParam = 2 * value.cols();
 	hessianCost.resize(nParam, nParam);
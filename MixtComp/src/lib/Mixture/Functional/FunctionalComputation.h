@@ -23,6 +23,8 @@
 #ifndef FUNCTIONALCOMPUTATION
 #define FUNCTIONALCOMPUTATION
 
+#include <algorithm>
+#include <cmath>
 #include <LinAlg/LinAlg.h>
 #include <LinAlg/Maths.h>
 #include <list>
@@ -83,7 +85,7 @@ void regression(const Matrix<Real>& design, const Vector<Real>& y, const betaTyp
 	Index nCoeff = design.cols();
 	beta.resize(nCoeff);
 
-	beta = (design.transpose() * design).inverse() * design.transpose() * y; // normal equation to get the coefficient beta
+	beta = (design.transpose() * design).ldlt().solve(design.transpose() * y); // normal equation to get the coefficient beta, solved by factorization instead of explicit inversion
 
 	estimateSD(design, y, beta, sd); // standard deviation is stored in the last coefficient of vector beta
 }
@@ -92,22 +94,24 @@ void subRegression(const Vector<Matrix<Real> >& design, const Vector<Vector<Real
 
 void timeValue(const Vector<Real>& t, Index nParam, const Vector<Real>& alpha, Matrix<Real>& logValue, Vector<Real>& logSumExpValue);
 
-void costFunction(const Vector<Real>& t, const Matrix<Real>& logValue, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Real& cost);
-
-Real costFunctionDebug(const Vector<Real>& t, const Vector<Real>& alpha, const Vector<std::set<Index> >& w);
+/**
+ * @param label subregression of each time step
+ */
+void costFunction(const Vector<Real>& t, const Matrix<Real>& logValue, const Vector<Real>& logSumExpValue, const Vector<Index>& label, Real& cost);
 
 Real deriv1Var(Index subReg, Index subRegInd, Index j, const Vector<Real>& t, const Matrix<Real>& value);
 
 Real deriv2Var(Index subReg0, Index subRegInd0, Index subReg1, Index subRegInd1, Index j, const Vector<Real>& t, const Matrix<Real>& value);
 
-void gradCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Vector<Real>& gradCost);
+void gradCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<Index>& label, Vector<Real>& gradCost);
 
 /**
- * This is useful if an exact Newton-Raphson algorithm is used. It is not used in BFGS-L for example.
+ * This is useful if an exact Newton-Raphson algorithm is used. It is not used in BFGS-L for example. The hessian does not depend on
+ * the subregression labels.
  */
-void hessianCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Matrix<Real>& hessianCost);
+void hessianCostFunction(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, Matrix<Real>& hessianCost);
 
-void hessianCostFunctionNoSym(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, const Vector<std::set<Index> >& w, Matrix<Real>& hessianCost);
+void hessianCostFunctionNoSym(const Vector<Real>& t, const Matrix<Real>& value, const Vector<Real>& logSumExpValue, Matrix<Real>& hessianCost);
 
 void initAlpha(Index nParam, const Vector<Real>& t, Vector<Real>& alpha);
 
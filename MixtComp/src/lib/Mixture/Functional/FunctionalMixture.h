@@ -28,6 +28,7 @@
 #include <IO/NamedAlgebra.h>
 #include <Mixture/Functional/Function.h>
 #include <Mixture/IMixture.h>
+#include "FunctionalBatch.h"
 #include "FunctionalClass.h"
 #include "FunctionalParser.h"
 
@@ -53,7 +54,11 @@ public:
 	}
 
 	void sampleUnobservedAndLatent(Index i, Index k) {
-		class_[k].samplingStepNoCheck(i);
+		if (batch_.isUpToDate(class_, k)) {
+			vecInd_(i).sampleWNoCheck(batch_.jointLogProba(), batch_.offset(i), k * nSub_);
+		} else {
+			vecInd_(i).sampleWNoCheck(class_[k].alpha(), class_[k].beta(), class_[k].sd());
+		}
 	}
 	;
 
@@ -74,16 +79,24 @@ public:
 	}
 
 	std::string mStep(const Vector<std::set<Index> >& classInd) {
-		std::string warnLog;
+		std::vector<std::string> vecWarnLog(nClass_);
 
+#pragma omp parallel for schedule(dynamic) // classes are independent, and their logs are concatenated in order afterward
 		for (Index k = 0; k < nClass_; ++k) {
 			std::string currLog;
 			currLog = class_[k].mStep(classInd(k));
 			if (0 < currLog.size()) {
-				warnLog += "Error in class " + std::to_string(k) + "." + eol + currLog;
+				vecWarnLog[k] = "Error in class " + std::to_string(k) + "." + eol + currLog;
 			}
 		}
 
+		std::string warnLog;
+		for (std::vector<std::string>::const_iterator it = vecWarnLog.begin(), itE = vecWarnLog.end(); it != itE; ++it) {
+			warnLog += *it;
+		}
+
+		batch_.refresh(class_);
+
 		return warnLog;
 	}
 	;
@@ -97,6 +110,7 @@ public:
 			for (Index k = 0; k < nClass_; ++k) {
 				class_[k].setExpectationParam();
 			}
+			batch_.refresh(class_);
 		}
 	}
 	;
@@ -106,11 +120,23 @@ public:
 	}
 	;
 
+	/**
+	 * The joint log proba is read in batch_, which is refreshed each time the parameters are modified. The individual is evaluated on its
+	 * own if the parameters of the class have been modified otherwise.
+	 */
 	Real lnCompletedProbability(Index i, Index k) const {
+		if (batch_.isUpToDate(class_, k)) {
+			return vecInd_(i).lnCompletedProbability(batch_.jointLogProba(), batch_.offset(i), k * nSub_);
+		}
+
 		return vecInd_(i).lnCompletedProbability(class_[k].alpha(), class_[k].beta(), class_[k].sd());
 	}
 
 	Real lnObservedProbability(Index i, Index k) const {
+		if (batch_.isUpToDate(class_, k)) {
+			return vecInd_(i).lnObservedProbability(batch_.jointLogProba(), batch_.offset(i), k * nSub_);
+		}
+
 		return vecInd_(i).lnObservedProbability(class_[k].alpha(), class_[k].beta(), class_[k].sd());
 	}
 
@@ -155,19 +181,21 @@ public:
 		}
 
 		// get the value of nSub_ and nCoeff_ by parsing paramStr_
-		std::string paramReStr = std::string("nSub: *") + strPositiveInteger + std::string(", nCoeff: *") + strPositiveInteger;
+		std::string paramReStr = std::string("nSub: *") + strPositiveInteger + std::string(", nCoeff: *") + strPositiveInteger + std::string("(?:, optim: *(BFGS|Newton))?");
 		std::regex paramRe(paramReStr);
 		std::smatch matches;
 		if (std::regex_match(paramStr_, matches, paramRe)) { // value is present
 			nSub_ = str2type<Index>(matches[1].str());
 			nCoeff_ = str2type<Index>(matches[2].str());
+			OptimType optim = (matches[3].str() == "Newton") ? Newton_ : BFGS_; // optional solver for alpha
 
 			for (Index k = 0; k < nClass_; ++k) { // call setSize on each class
 				class_[k].setSize(nSub_, nCoeff_);
+				class_[k].setOptim(optim);
 			}
 		} else {
 			std::stringstream sstm;
-			sstm << "Variable: " << idName_ << " has no parameter description. This description is required, and must take the form " << "\"nSub: x, nCoeff: y\"" << std::endl;
+			sstm << "Variable: " << idName_ << " has no parameter description. This description is required, and must take the form " << "\"nSub: x, nCoeff: y\", optionally followed by \", optim: Newton\"" << std::endl;
 			warnLog += sstm.str();
 		}
 
@@ -203,6 +231,9 @@ public:
 			return warnLog;
 		}
 
+		batch_.set(vecInd_, nCoeff_);
+		batch_.refresh(class_);
+
 		globalQuantile(vecInd_, quantile_);
 
 		// TODO: datastat will be setup here when partially observed value will be supported
@@ -214,30 +245,31 @@ public:
 	/**
 	 * Linearize and format the information provided by each class, and send it to the usual extractors, nothing fancy here.
 	 */
-	void exportDataParam() const {
-		std::vector<std::vector<Real>> data(nInd_);
-		std::vector<std::vector<Real>> time(nInd_);
-
-		for (Index i = 0; i < nInd_; ++i) {
-			Index nTime = vecInd_(i).nTime();
-			data[i].resize(nTime);
-			time[i].resize(nTime);
-
-			for (Index t = 0; t < nTime; ++t) {
-				data[i][t] = vecInd_(i).x()(t);
-				time[i][t] = vecInd_(i).t()(t);
+	void exportDataParam(const OutputSelection& os) const {
+		if (os.completed_) {
+			std::vector<std::vector<Real>> data(nInd_);
+			std::vector<std::vector<Real>> time(nInd_);
+
+			for (Index i = 0; i < nInd_; ++i) {
+				Index nTime = vecInd_(i).nTime();
+				data[i].resize(nTime);
+				time[i].resize(nTime);
+
+				for (Index t = 0; t < nTime; ++t) {
+					data[i][t] = vecInd_(i).x()(t);
+					time[i][t] = vecInd_(i).t()(t);
+				}
 			}
-		}
 
-		outG_.add_payload( { "variable", "data", idName_ }, "data", data);
-		outG_.add_payload( { "variable", "data", idName_ }, "time", time);
+			outG_.add_payload( { "variable", "data", idName_ }, "data", data);
+			outG_.add_payload( { "variable", "data", idName_ }, "time", time);
+		}
 
 		Index sizeClassAlpha = nSub_ * 2;
 		Index sizeClassBeta = nSub_ * nCoeff_;
 		Index sizeClassSd = nSub_;
 
 		Index nStat = class_[0].alphaParamStat().getStatStorage().cols();
-
 		std::vector<std::string> colNames;
 		quantileNames(nStat, confidenceLevel_, colNames);
 
@@ -245,21 +277,10 @@ public:
 		NamedMatrix<Real> betaStat = { betaParamNames(), colNames, Matrix<Real>(nClass_ * sizeClassBeta, nStat) };
 		NamedMatrix<Real> sdStat = { sdParamNames(), colNames, Matrix<Real>(nClass_ * sizeClassSd, nStat) };
 
-		Index nObs = class_[0].alphaParamStat().getLogStorage().cols();
-
-		NamedMatrix<Real> alphaLog = { alphaParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassAlpha, nObs) }; // linearized and concatenated version of alpha
-		NamedMatrix<Real> betaLog = { betaParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassBeta, nObs)};
-		NamedMatrix<Real> sdLog = { sdParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassSd, nObs)};
-
 		for (Index k = 0; k < nClass_; ++k) {
 			alphaStat.mat_.block(k * sizeClassAlpha, 0, sizeClassAlpha, nStat) = class_[k].alphaParamStat().getStatStorage();
-			alphaLog.mat_.block(k * sizeClassAlpha, 0, sizeClassAlpha, nObs) = class_[k].alphaParamStat().getLogStorage();
-
 			betaStat.mat_.block(k * sizeClassBeta, 0, sizeClassBeta, nStat) = class_[k].betaParamStat().getStatStorage();
-			betaLog.mat_.block(k * sizeClassBeta, 0, sizeClassBeta, nObs) = class_[k].betaParamStat().getLogStorage();
-
 			sdStat.mat_.block(k * sizeClassSd, 0, sizeClassSd, nStat) = class_[k].sdParamStat().getStatStorage();
-			sdLog.mat_.block(k * sizeClassSd, 0, sizeClassSd, nObs) = class_[k].sdParamStat().getLogStorage();
 		}
 
 		outG_.add_payload( { "variable", "param", idName_ }, "paramStr", paramStr_);
@@ -268,9 +289,23 @@ public:
 		outG_.add_payload( { "variable", "param", idName_, "beta" }, "stat", betaStat);
 		outG_.add_payload( { "variable", "param", idName_, "sd" }, "stat", sdStat);
 
-		outG_.add_payload( { "variable", "param", idName_, "alpha" }, "log", alphaLog);
-		outG_.add_payload( { "variable", "param", idName_, "beta" }, "log", betaLog);
-		outG_.add_payload( { "variable", "param", idName_, "sd" }, "log", sdLog);
+		if (os.paramLog_) {
+			Index nObs = class_[0].alphaParamStat().getLogStorage().cols();
+
+			NamedMatrix<Real> alphaLog = { alphaParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassAlpha, nObs) }; // linearized and concatenated version of alpha
+			NamedMatrix<Real> betaLog = { betaParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassBeta, nObs) };
+			NamedMatrix<Real> sdLog = { sdParamNames(), std::vector<std::string>(), Matrix<Real>(nClass_ * sizeClassSd, nObs) };
+
+			for (Index k = 0; k < nClass_; ++k) {
+				alphaLog.mat_.block(k * sizeClassAlpha, 0, sizeClassAlpha, nObs) = class_[k].alphaParamStat().getLogStorage();
+				betaLog.mat_.block(k * sizeClassBeta, 0, sizeClassBeta, nObs) = class_[k].betaParamStat().getLogStorage();
+				sdLog.mat_.block(k * sizeClassSd, 0, sizeClassSd, nObs) = class_[k].sdParamStat().getLogStorage();
+			}
+
+			outG_.add_payload( { "variable", "param", idName_, "alpha" }, "log", alphaLog);
+			outG_.add_payload( { "variable", "param", idName_, "beta" }, "log", betaLog);
+			outG_.add_payload( { "variable", "param", idName_, "sd" }, "log", sdLog);
+		}
 	}
 	;
 
@@ -287,6 +322,7 @@ public:
 		for (Index k = 0; k < nClass_; ++k) {
 			class_[k].initParam();
 		}
+		batch_.refresh(class_);
 	}
 	;
 
@@ -374,6 +410,9 @@ private:
 
 	/** Data */
 	Vector<Function> vecInd_;
+
+	/** Packed copy of vecInd_, used to evaluate the joint log proba of all individuals at once. */
+	FunctionalBatch batch_;
 	Vector<Real> quantile_;
 
 	const Graph& dataG_;
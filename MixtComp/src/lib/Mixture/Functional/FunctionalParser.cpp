@@ -64,8 +64,6 @@ std::string parseFunctionalStr(Index nSub, Index nCoeff, const std::vector<std::
 
 			vecInd(ind).setValTime(i, t, x);
 		}
-
-		vecInd(ind).computeVandermonde(nCoeff);
 	}
 
 	return warnLog;
@@ -0,0 +1,111 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 19, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <algorithm>
+
+#include "RegStat.h"
+
+namespace mixt {
+
+RegStat::RegStat() :
+		n_(0) {
+}
+
+void RegStat::setSize(Index nCoeff) {
+	n_ = 0;
+	mean_.resize(nCoeff);
+	mean_ = 0.;
+	m2_.resize(nCoeff, nCoeff);
+	m2_ = 0.;
+	obs_.resize(nCoeff);
+	delta_.resize(nCoeff);
+}
+
+void RegStat::setObs(Real t, Real x) {
+	Index nCoeff = mean_.size();
+	Real currPow = t;
+	for (Index c = 0; c < nCoeff - 1; ++c) {
+		obs_(c) = currPow;
+		currPow *= t;
+	}
+	obs_(nCoeff - 1) = x;
+}
+
+void RegStat::add(Real t, Real x) {
+	setObs(t, x);
+	++n_;
+	delta_ = obs_ - mean_;
+	mean_ += delta_ / Real(n_);
+	m2_.noalias() += (Real(n_ - 1) / Real(n_)) * delta_ * delta_.transpose(); // equal to delta (obs - mean)^T with the updated mean, but exactly symmetric
+}
+
+void RegStat::remove(Real t, Real x) {
+	if (n_ == 1) {
+		setSize(mean_.size());
+		return;
+	}
+
+	setObs(t, x);
+	delta_ = obs_ - mean_;
+	mean_ -= delta_ / Real(n_ - 1);
+	m2_.noalias() -= (Real(n_) / Real(n_ - 1)) * delta_ * delta_.transpose();
+	--n_;
+}
+
+void RegStat::merge(const RegStat& other) {
+	if (other.n_ == 0) {
+		return;
+	}
+
+	if (n_ == 0) {
+		n_ = other.n_;
+		mean_ = other.mean_;
+		m2_ = other.m2_;
+		return;
+	}
+
+	Index nTotal = n_ + other.n_;
+	delta_ = other.mean_ - mean_;
+	mean_ += (Real(other.n_) / Real(nTotal)) * delta_;
+	m2_ += other.m2_;
+	m2_.noalias() += (Real(n_) * Real(other.n_) / Real(nTotal)) * delta_ * delta_.transpose();
+	n_ = nTotal;
+}
+
+void RegStat::regressionVec(Vector<Real>& beta, Real& rss) const {
+	Index nCoeff = mean_.size();
+	Index nSlope = nCoeff - 1; // coefficients of the non constant terms, the constant is deduced from the means
+
+	Matrix<Real> ctc = m2_.topLeftCorner(nSlope, nSlope);
+	Vector<Real> ctx = m2_.col(nSlope).head(nSlope);
+	Vector<Real> slope = ctc.ldlt().solve(ctx);
+
+	beta.resize(nCoeff);
+	beta(0) = mean_(nSlope) - mean_.head(nSlope).dot(slope);
+	for (Index c = 0; c < nSlope; ++c) {
+		beta(c + 1) = slope(c);
+	}
+
+	rss = std::max(m2_(nSlope, nSlope) - ctx.dot(slope), 0.); // with centered moments, the cancellation is relative to the variance of x and not to its offset
+}
+
+} // namespace mixt
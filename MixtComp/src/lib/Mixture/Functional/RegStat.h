@@ -0,0 +1,93 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 19, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef REGSTAT
+#define REGSTAT
+
+#include <LinAlg/LinAlg.h>
+
+namespace mixt {
+
+/**
+ * Sufficient statistics of the polynomial regression of x on t, for a set of observations (t, x). The mean and the centered second
+ * moments of (t, t^2, ..., t^(nCoeff - 1), x) are kept, so that the coefficients and the residual sum of squares are obtained without
+ * a pass on the observations, and without the cancellation that occurs in y^T y - beta^T X^T y when the values have a large offset.
+ *
+ * Observations are added and removed with the update of Welford, and the statistics of disjoint sets are merged with the update of
+ * Chan et al., as in meanSD.
+ */
+class RegStat {
+public:
+	RegStat();
+
+	/** Empty the statistics, for a regression with nCoeff coefficients. */
+	void setSize(Index nCoeff);
+
+	void add(Real t, Real x);
+
+	/** Remove an observation previously added. */
+	void remove(Real t, Real x);
+
+	/** Add all the observations of other, which must have the same number of coefficients. */
+	void merge(const RegStat& other);
+
+	/**
+	 * Least squares coefficients, and residual sum of squares of the regression, obtained from the statistics only.
+	 * @param beta coefficients, in increasing degree, resized to nCoeff
+	 */
+	template<typename betaType>
+	void regression(const betaType& betaIn, Real& rss) const {
+		betaType& beta = const_cast<betaType&>(betaIn); // without the const_cast it is impossible to access a row which is a temporary object requiring a const in the argument
+		Vector<Real> betaVec;
+		regressionVec(betaVec, rss);
+		beta = betaVec;
+	}
+
+	Index n() const {
+		return n_;
+	}
+
+	Index nCoeff() const {
+		return mean_.size();
+	}
+
+private:
+	void regressionVec(Vector<Real>& beta, Real& rss) const;
+
+	/** Fill obs_ with (t, t^2, ..., t^(nCoeff - 1), x). */
+	void setObs(Real t, Real x);
+
+	Index n_;
+
+	/** Mean of the observations (t, t^2, ..., t^(nCoeff - 1), x). */
+	Vector<Real> mean_;
+
+	/** Sum of the outer products of the centered observations. */
+	Matrix<Real> m2_;
+
+	Vector<Real> obs_;
+	Vector<Real> delta_;
+};
+
+} // namespace mixt
+
+#endif // REGSTAT
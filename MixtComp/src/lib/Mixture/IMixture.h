@@ -24,6 +24,7 @@
 #ifndef LIB_MIXTURE_IMIXTURE_H
 #define LIB_MIXTURE_IMIXTURE_H
 
+#include <IO/OutputSelection.h>
 #include <LinAlg/LinAlg.h>
 #include <iostream>
 #include <set>
@@ -68,6 +69,19 @@ public:
 	 * */
 	virtual void sampleUnobservedAndLatent(Index ind, Index k) = 0;
 
+	/**
+	 * Same as sampleUnobservedAndLatent, for all the individuals at once. By default the individuals are sampled
+	 * independently, models which can sample several individuals together override it.
+	 *
+	 * @param z class of each individual
+	 * */
+	virtual void sampleAllUnobservedAndLatent(const Vector<Index>& z) {
+#pragma omp parallel for
+		for (Index i = 0; i < nInd_; ++i) {
+			sampleUnobservedAndLatent(i, z(i));
+		}
+	}
+
 
 	/**
 	 * Check if conditions on data are verified. For example, for a categorical model one must check that each modality
@@ -139,8 +153,9 @@ public:
 
 	/**
 	 * Export of parameters and data
+	 * @param os sections of the output to be exported, the parameter stat and paramStr are always exported
 	 * */
-	virtual void exportDataParam() const = 0;
+	virtual void exportDataParam(const OutputSelection& os) const = 0;
 
 	/**
 	 * Initialization of missing / latent data priori to any parameter knowledge. In prediction parameters are known at
@@ -0,0 +1,321 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <Various/Constants.h>
+#include "MultivariateGaussianClass.h"
+
+namespace mixt {
+
+namespace {
+
+/** Last version attributed, 0 is never attributed and denotes an empty cache in MultivariateGaussianMixture. */
+std::atomic<Index> lastParamVersion(0);
+
+/**
+ * Inverse of the lower Cholesky factor of a covariance matrix, and log of the normalization constant of the corresponding normal density.
+ *
+ * @return false if cov is not positive definite
+ */
+bool invCholesky(const Matrix<Real>& cov, Matrix<Real>& invChol, Real& logNormConst) {
+	Index nDim = cov.rows();
+	Eigen::LLT<Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> > llt(cov);
+	if (llt.info() != Eigen::Success) {
+		return false;
+	}
+
+	invChol = Matrix<Real>::Identity(nDim, nDim);
+	llt.matrixL().solveInPlace(invChol);
+
+	logNormConst = -Real(nDim) * l2pi;
+	for (Index j = 0; j < nDim; ++j) {
+		if (!(invChol(j, j) * epsilon < 1.)) { // the diagonal of the Cholesky factor must be larger than epsilon, nan is also rejected
+			return false;
+		}
+		logNormConst += std::log(invChol(j, j)); // the determinant of invChol is the product of its diagonal
+	}
+
+	return true;
+}
+
+}
+
+MultivariateGaussianClass::MultivariateGaussianClass(Matrix<Real>& data, const std::vector<MissingPattern>& patterns, Real confidenceLevel) :
+		paramVersion_(0), nDim_(0), diagonal_(false), data_(data), patterns_(patterns), logNormConst_(0.), paramStat_(param_, confidenceLevel) {
+}
+
+void MultivariateGaussianClass::setSize(Index nDim, bool diagonal) {
+	nDim_ = nDim;
+	diagonal_ = diagonal;
+	param_.resize(nParam());
+	initParam();
+}
+
+Index MultivariateGaussianClass::nParam() const {
+	return (diagonal_) ? (2 * nDim_) : (nDim_ + nDim_ * (nDim_ + 1) / 2);
+}
+
+std::string MultivariateGaussianClass::setParam(const Vector<Real>& param) {
+	param_ = param;
+	return computeDecomposition();
+}
+
+void MultivariateGaussianClass::initParam() {
+	param_ = 0.;
+	for (Index j = 0, c = nDim_; j < nDim_; ++j) { // identity covariance, until the first mStep
+		param_(c) = 1.;
+		c += (diagonal_) ? (1) : (nDim_ - j);
+	}
+	computeDecomposition();
+}
+
+std::string MultivariateGaussianClass::mStep(const std::set<Index>& setInd) {
+	std::string warnLog;
+	Index nInd = setInd.size();
+
+	Matrix<Real> x(nInd, nDim_);
+	Index r = 0;
+	for (std::set<Index>::const_iterator it = setInd.begin(), itE = setInd.end(); it != itE; ++it, ++r) {
+		x.row(r) = data_.row(*it);
+	}
+
+	Vector<Real> mean = x.colwise().mean().transpose();
+	x.rowwise() -= mean.transpose();
+
+	param_.head(nDim_) = mean;
+	if (diagonal_) {
+		param_.tail(nDim_) = x.colwise().squaredNorm().transpose() / Real(nInd);
+	} else {
+		Matrix<Real> cov(nDim_, nDim_);
+		cov.noalias() = x.transpose() * x / Real(nInd);
+		setCovParam(cov);
+	}
+
+	std::string decompositionLog = computeDecomposition();
+	for (Index j = 0; j < nDim_; ++j) {
+		if (std::sqrt(cov_(j, j)) < epsilon) {
+			warnLog += "MultivariateGaussian variables must have a minimum standard deviation of " + epsilonStr + " on each coordinate in each class. It is not the case for coordinate: "
+					+ std::to_string(j + minModality) + "." + eol;
+		}
+	}
+	if (warnLog.size() == 0) {
+		warnLog += decompositionLog;
+	}
+
+	return warnLog;
+}
+
+std::string MultivariateGaussianClass::checkSampleCondition(const std::set<Index>& setInd) const {
+	Index minInd = (diagonal_) ? (2) : (nDim_ + 1);
+	if (setInd.size() < minInd) {
+		return "MultivariateGaussian variables must have at least " + std::to_string(minInd)
+				+ " individuals per class, so that the covariance matrix can be estimated. This is not the case for at least one class. You can check whether you have enough individuals regarding the number of classes, or use a diagonal covariance."
+				+ eol;
+	}
+
+	return "";
+}
+
+void MultivariateGaussianClass::lnDensity(Vector<Real>& logProba) const {
+	Matrix<Real> centered = data_.rowwise() - mean_.transpose();
+
+	Matrix<Real> z(data_.rows(), nDim_);
+	if (diagonal_) {
+		z = (centered.array().rowwise() * invChol_.diagonal().transpose().array()).matrix();
+	} else {
+		z.noalias() = centered * invChol_.transpose(); // Mahalanobis distances of all the individuals in a single product
+	}
+
+	logProba = (logNormConst_ - 0.5 * z.rowwise().squaredNorm().array()).matrix();
+}
+
+Real MultivariateGaussianClass::lnDensity(Index i) const {
+	Vector<Real> z = invChol_.triangularView<Eigen::Lower>() * (data_.row(i).transpose() - mean_);
+	return logNormConst_ - 0.5 * z.squaredNorm();
+}
+
+Real MultivariateGaussianClass::lnObservedDensity(Index p, Index i) const {
+	const std::vector<Index>& obs = patterns_[p].obs_;
+	const Conditional& cond = cond_[p];
+
+	Vector<Real> centered(obs.size());
+	for (Index o = 0; o < obs.size(); ++o) {
+		centered(o) = data_(i, obs[o]) - mean_(obs[o]);
+	}
+
+	Vector<Real> z = cond.invCholObs_.triangularView<Eigen::Lower>() * centered;
+	return cond.logNormConstObs_ - 0.5 * z.squaredNorm();
+}
+
+void MultivariateGaussianClass::sampleMissing(Index p, const std::vector<Index>& ind) {
+	const std::vector<Index>& mis = patterns_[p].mis_;
+	const std::vector<Index>& obs = patterns_[p].obs_;
+	const Conditional& cond = cond_[p];
+	Index nInd = ind.size();
+	Index nMis = mis.size();
+	Index nObs = obs.size();
+
+	Matrix<Real> centered(nInd, nObs);
+	for (Index r = 0; r < nInd; ++r) {
+		for (Index o = 0; o < nObs; ++o) {
+			centered(r, o) = data_(ind[r], obs[o]) - mean_(obs[o]);
+		}
+	}
+
+	Matrix<Real> noise(nInd, nMis);
+	for (Index r = 0; r < nInd; ++r) {
+		for (Index m = 0; m < nMis; ++m) {
+			noise(r, m) = normal_.sample(0., 1.);
+		}
+	}
+
+	Matrix<Real> x(nInd, nMis);
+	x.noalias() = centered * cond.regression_.transpose(); // conditional expectations of all the individuals in a single product
+	x.noalias() += noise * cond.condChol_.transpose();
+
+	for (Index r = 0; r < nInd; ++r) {
+		for (Index m = 0; m < nMis; ++m) {
+			data_(ind[r], mis[m]) = x(r, m) + mean_(mis[m]);
+		}
+	}
+}
+
+void MultivariateGaussianClass::sampleParam(Index iteration, Index iterationMax) {
+	paramStat_.sampleParam(iteration, iterationMax);
+}
+
+void MultivariateGaussianClass::setExpectationParam() {
+	Vector<Real> lastParam = param_;
+	paramStat_.setExpectationParam();
+
+	if (0 < computeDecomposition().size()) { // the median of each coefficient does not always form a positive definite covariance
+		projectCov();
+		if (0 < computeDecomposition().size()) {
+			param_ = lastParam;
+			computeDecomposition();
+		}
+		paramStat_.setStatStorageParam(); // the exported median must be the parameter used in the Gibbs and in prediction
+	}
+}
+
+void MultivariateGaussianClass::setParamStorage() {
+	paramStat_.setParamStorage();
+}
+
+std::string MultivariateGaussianClass::computeDecomposition() {
+	updateParamVersion();
+
+	mean_ = param_.head(nDim_);
+	cov_.resize(nDim_, nDim_);
+	cov_ = 0.;
+	for (Index j = 0, c = nDim_; j < nDim_; ++j) {
+		if (diagonal_) {
+			cov_(j, j) = param_(c++);
+		} else {
+			for (Index i = j; i < nDim_; ++i, ++c) {
+				cov_(i, j) = param_(c);
+				cov_(j, i) = param_(c);
+			}
+		}
+	}
+
+	if (!invCholesky(cov_, invChol_, logNormConst_)) {
+		return "The covariance matrix is not positive definite. Some coordinates may be collinear in this class, or the class may contain too few individuals."
+				+ eol;
+	}
+
+	cond_.resize(patterns_.size());
+	for (Index p = 1; p < patterns_.size(); ++p) { // the first pattern has no missing coordinates
+		const std::vector<Index>& mis = patterns_[p].mis_;
+		const std::vector<Index>& obs = patterns_[p].obs_;
+		Index nMis = mis.size();
+		Index nObs = obs.size();
+		Conditional& cond = cond_[p];
+
+		Matrix<Real> covObs(nObs, nObs);
+		Matrix<Real> covMisObs(nMis, nObs);
+		Matrix<Real> condCov(nMis, nMis);
+		for (Index o = 0; o < nObs; ++o) {
+			for (Index o2 = 0; o2 < nObs; ++o2) {
+				covObs(o, o2) = cov_(obs[o], obs[o2]);
+			}
+			for (Index m = 0; m < nMis; ++m) {
+				covMisObs(m, o) = cov_(mis[m], obs[o]);
+			}
+		}
+		for (Index m = 0; m < nMis; ++m) {
+			for (Index m2 = 0; m2 < nMis; ++m2) {
+				condCov(m, m2) = cov_(mis[m], mis[m2]);
+			}
+		}
+
+		invCholesky(covObs, cond.invCholObs_, cond.logNormConstObs_); // a principal submatrix of a positive definite matrix is positive definite
+
+		Matrix<Real> whitened(nMis, nObs); // Cov(mis, obs) L^-T, so that regression = whitened L^-1 and whitened whitened^T = regression Cov(obs, mis)
+		whitened.noalias() = covMisObs * cond.invCholObs_.transpose();
+		cond.regression_.resize(nMis, nObs);
+		cond.regression_.noalias() = whitened * cond.invCholObs_;
+		condCov.noalias() -= whitened * whitened.transpose();
+
+		Eigen::LLT<Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> > llt(condCov);
+		if (llt.info() != Eigen::Success) { // a Schur complement of a positive definite matrix is positive definite, unless cov_ is badly conditioned
+			return "The covariance matrix is badly conditioned, and the conditional distributions of the missing coordinates can not be computed." + eol;
+		}
+		Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> condChol = llt.matrixL();
+		cond.condChol_ = condChol;
+	}
+
+	return "";
+}
+
+void MultivariateGaussianClass::setCovParam(const Matrix<Real>& cov) {
+	for (Index j = 0, c = nDim_; j < nDim_; ++j) {
+		if (diagonal_) {
+			param_(c++) = cov(j, j);
+		} else {
+			for (Index i = j; i < nDim_; ++i, ++c) {
+				param_(c) = cov(i, j);
+			}
+		}
+	}
+}
+
+void MultivariateGaussianClass::projectCov() {
+	Eigen::SelfAdjointEigenSolver<Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> > eigen(cov_);
+	Eigen::Matrix<Real, Eigen::Dynamic, 1> lambda = eigen.eigenvalues();
+	Real minLambda = epsilon * std::max(1., lambda.maxCoeff()); // the diagonal of the Cholesky factor is then larger than epsilon
+	lambda = lambda.cwiseMax(minLambda);
+
+	Matrix<Real> cov(nDim_, nDim_);
+	cov.noalias() = eigen.eigenvectors() * lambda.asDiagonal() * eigen.eigenvectors().transpose();
+	setCovParam(cov);
+}
+
+void MultivariateGaussianClass::updateParamVersion() {
+	paramVersion_ = ++lastParamVersion;
+}
+
+} // namespace mixt
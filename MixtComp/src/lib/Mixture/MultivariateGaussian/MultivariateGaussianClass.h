@@ -0,0 +1,167 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANCLASS_H
+#define LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANCLASS_H
+
+#include <set>
+#include <vector>
+#include <LinAlg/LinAlg.h>
+#include <Param/ConfIntParamStat.h>
+#include <Statistic/NormalStatistic.h>
+#include "MultivariateGaussianParser.h"
+
+namespace mixt {
+
+/**
+ * Parameters of a class of a MultivariateGaussianMixture, with the quantities derived from them each time they are modified: the inverse
+ * of the Cholesky factor of the covariance, used to evaluate the densities of all the individuals with a single matrix product, and the
+ * conditional distributions of the missing coordinates for each missing pattern.
+ *
+ * With a diagonal covariance the Cholesky factor is diagonal, and the densities are computed coordinate by coordinate.
+ */
+class MultivariateGaussianClass {
+public:
+	MultivariateGaussianClass(Matrix<Real>& data, const std::vector<MissingPattern>& patterns, Real confidenceLevel);
+
+	void setSize(Index nDim, bool diagonal);
+
+	/** Number of coefficients in the linearized parameters: the mean, then the lower triangle of the covariance column by column, or its
+	 * diagonal. */
+	Index nParam() const;
+
+	/**
+	 * Set the parameters from their linearized version, for example in prediction.
+	 *
+	 * @return empty string if the covariance is positive definite, otherwise errors description
+	 */
+	std::string setParam(const Vector<Real>& param);
+
+	/** Maximum likelihood estimation of the mean and of the covariance, using the individuals in setInd. */
+	std::string mStep(const std::set<Index>& setInd);
+
+	void initParam();
+
+	std::string checkSampleCondition(const std::set<Index>& setInd) const;
+
+	/** Log density of every individual, computed with a single product between the centered data and the inverse Cholesky factor. */
+	void lnDensity(Vector<Real>& logProba) const;
+
+	/** Log density of individual i. */
+	Real lnDensity(Index i) const;
+
+	/** Log density of the observed coordinates of individual i, which has the missing pattern p. */
+	Real lnObservedDensity(Index p, Index i) const;
+
+	/**
+	 * Sample the missing coordinates of the individuals ind, which all have the missing pattern p, from their distribution conditional
+	 * to the observed coordinates. The conditional expectations of all the individuals are computed with a single product.
+	 */
+	void sampleMissing(Index p, const std::vector<Index>& ind);
+
+	void sampleParam(Index iteration, Index iterationMax);
+
+	/** Set the parameters to the median of the values sampled during the SEM. If the resulting covariance is not positive definite, it is
+	 * projected on the positive definite matrices, and the exported median is replaced by the parameters actually used. */
+	void setExpectationParam();
+
+	void setParamStorage();
+
+	const ConfIntParamStat<Vector<Real> >& paramStat() const {
+		return paramStat_;
+	}
+
+	const Vector<Real>& mean() const {
+		return mean_;
+	}
+
+	const Matrix<Real>& cov() const {
+		return cov_;
+	}
+
+	/**
+	 * Identifier of the current values of the parameters, different each time they are modified, and unique among all the
+	 * MultivariateGaussianClass objects. It is used to invalidate the log densities cached in MultivariateGaussianMixture.
+	 */
+	Index paramVersion() const {
+		return paramVersion_;
+	}
+
+private:
+	/** Quantities of a missing pattern that depend on the parameters. */
+	struct Conditional {
+		/** Inverse of the Cholesky factor of the covariance of the observed coordinates. */
+		Matrix<Real> invCholObs_;
+
+		Real logNormConstObs_;
+
+		/** Cov(mis, obs) Cov(obs, obs)^-1, the conditional expectation is mean(mis) + regression (x(obs) - mean(obs)). */
+		Matrix<Real> regression_;
+
+		/** Cholesky factor of the conditional covariance Cov(mis, mis) - regression Cov(obs, mis). */
+		Matrix<Real> condChol_;
+	};
+
+	/** Compute the mean and covariance from param_, then the Cholesky factorization and the conditionals of the patterns. */
+	std::string computeDecomposition();
+
+	void updateParamVersion();
+
+	/** Write the lower triangle of cov, or its diagonal, in param_. */
+	void setCovParam(const Matrix<Real>& cov);
+
+	/** Replace the covariance in param_ by the nearest positive definite matrix, by raising its eigenvalues to a minimum value. */
+	void projectCov();
+
+	Index paramVersion_;
+
+	Index nDim_;
+
+	bool diagonal_;
+
+	/** Data, not const because sampling has to occur at some point */
+	Matrix<Real>& data_;
+
+	const std::vector<MissingPattern>& patterns_;
+
+	/** Linearized parameters, see nParam, stored contiguously for paramStat_. */
+	Vector<Real> param_;
+
+	Vector<Real> mean_;
+
+	Matrix<Real> cov_;
+
+	/** Inverse of the lower Cholesky factor L of cov_, so that the Mahalanobis distance of x is |invChol_ (x - mean_)|^2. */
+	Matrix<Real> invChol_;
+
+	Real logNormConst_;
+
+	std::vector<Conditional> cond_;
+
+	ConfIntParamStat<Vector<Real> > paramStat_;
+
+	NormalStatistic normal_;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANCLASS_H
@@ -0,0 +1,483 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANMIXTURE_H
+#define LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANMIXTURE_H
+
+#include <cmath>
+#include <regex>
+#include <set>
+#include <vector>
+#include <Data/AugmentedData.h>
+#include <Data/ConfIntDataStat.h>
+#include <IO/IOFunctions.h>
+#include <IO/NamedAlgebra.h>
+#include <IO/SpecialStr.h>
+#include <Mixture/IMixture.h>
+#include <Statistic/UniformStatistic.h>
+#include <Various/Constants.h>
+#include "MultivariateGaussianClass.h"
+#include "MultivariateGaussianParser.h"
+
+namespace mixt {
+
+/**
+ * Real vectors of dimension nDim, described by a multivariate normal distribution in each class, with a full or a diagonal covariance. Each
+ * individual is a list of coordinates, some of which can be missing, see parseMultivariateGaussianStr.
+ *
+ * The log densities of all the individuals in a class are computed at once by MultivariateGaussianClass::lnDensity, and cached until the
+ * parameters of the class change. The cache is refreshed serially by refreshLnDensity each time the parameters are modified, so that the
+ * individuals processed in parallel only read it, or write their own row. The missing coordinates are sampled from their distribution conditional to the observed ones, all the
+ * individuals sharing a missing pattern and a class being sampled together.
+ */
+template<typename Graph>
+class MultivariateGaussianMixture: public IMixture {
+public:
+	MultivariateGaussianMixture(const Graph& data, const Graph& param, Graph& out, std::string const& idName, Index nClass, Index nInd, Real confidenceLevel, const std::string& paramStr) :
+			IMixture(idName, "MultivariateGaussian", nClass, nInd), nDim_(0), diagonal_(false), confidenceLevel_(confidenceLevel), dataG_(data), paramG_(param), outG_(out), paramStr_(
+					paramStr) {
+		class_.reserve(nClass_);
+		for (Index k = 0; k < nClass_; ++k) {
+			class_.emplace_back(data_, patterns_, confidenceLevel);
+		}
+	}
+
+	void sampleUnobservedAndLatent(Index i, Index k) {
+		Index p = patternInd_(i);
+		if (p != 0) {
+			class_[k].sampleMissing(p, std::vector<Index>(1, i));
+			updateCacheRow(i);
+		}
+	}
+
+	/**
+	 * The individuals are grouped by missing pattern and class, so that the conditional expectations of each group are computed with a single
+	 * product.
+	 */
+	void sampleAllUnobservedAndLatent(const Vector<Index>& z) {
+		for (Index p = 1; p < patterns_.size(); ++p) {
+			std::vector<std::vector<Index> > classInd(nClass_);
+			for (std::vector<Index>::const_iterator it = patterns_[p].ind_.begin(), itE = patterns_[p].ind_.end(); it != itE; ++it) {
+				classInd[z(*it)].push_back(*it);
+			}
+
+			for (Index k = 0; k < nClass_; ++k) {
+				if (0 < classInd[k].size()) {
+					class_[k].sampleMissing(p, classInd[k]);
+				}
+			}
+		}
+
+		if (1 < patterns_.size()) {
+			cacheVersion_.assign(nClass_, 0); // the rows of the cache that changed are not tracked, it is fully recomputed
+			refreshLnDensity();
+		}
+	}
+
+	std::string checkSampleCondition(const Vector<std::set<Index> >& classInd) const {
+		std::string classLog;
+		for (Index k = 0; k < nClass_; ++k) {
+			std::string currClassLog = class_[k].checkSampleCondition(classInd(k));
+			if (0 < currClassLog.size()) {
+				classLog += "Class: " + std::to_string(k) + ": " + currClassLog;
+			}
+		}
+
+		if (0 < classLog.size()) {
+			return "Error(s) in variable: " + idName_ + " with MultivariateGaussian model. The errors in the various classes are: " + eol + classLog;
+		}
+
+		return "";
+	}
+
+	std::string mStep(const Vector<std::set<Index> >& classInd) {
+		std::vector<std::string> vecWarnLog(nClass_);
+
+#pragma omp parallel for schedule(dynamic) // classes are independent, and their logs are concatenated in order afterward
+		for (Index k = 0; k < nClass_; ++k) {
+			std::string currLog;
+			currLog = class_[k].mStep(classInd(k));
+			if (0 < currLog.size()) {
+				vecWarnLog[k] = "Error in class " + std::to_string(k) + "." + eol + currLog;
+			}
+		}
+
+		refreshLnDensity();
+
+		std::string warnLog;
+		for (std::vector<std::string>::const_iterator it = vecWarnLog.begin(), itE = vecWarnLog.end(); it != itE; ++it) {
+			warnLog += *it;
+		}
+
+		if (0 < warnLog.size()) {
+			return "Error(s) in variable: " + idName_ + " with MultivariateGaussian model." + eol + warnLog;
+		}
+
+		return "";
+	}
+
+	void storeSEMRun(Index iteration, Index iterationMax) {
+		for (Index k = 0; k < nClass_; ++k) {
+			class_[k].sampleParam(iteration, iterationMax);
+		}
+
+		if (iteration == iterationMax) {
+			for (Index k = 0; k < nClass_; ++k) {
+				class_[k].setExpectationParam();
+			}
+			refreshLnDensity();
+		}
+	}
+
+	/**
+	 * The statistics on the missing values are computed coordinate by coordinate, and the missing coordinates are imputed with their
+	 * median at the last iteration.
+	 */
+	void storeGibbsRun(Index i, Index iteration, Index iterationMax) {
+		const std::vector<Index>& mis = patterns_[patternInd_(i)].mis_;
+		for (std::vector<Index>::const_iterator it = mis.begin(), itE = mis.end(); it != itE; ++it) {
+			augData_[*it].data_(i) = data_(i, *it);
+			dataStat_[*it].sampleVals(i, iteration, iterationMax);
+			if (iteration == iterationMax) {
+				dataStat_[*it].imputeData(i);
+				data_(i, *it) = augData_[*it].data_(i);
+			}
+		}
+
+		if (iteration == iterationMax && 0 < mis.size()) {
+			updateCacheRow(i);
+		}
+	}
+
+	Real lnCompletedProbability(Index i, Index k) const {
+		return lnDensity(i, k);
+	}
+
+	Real lnObservedProbability(Index i, Index k) const {
+		Index p = patternInd_(i);
+		if (p == 0) {
+			return lnDensity(i, k);
+		}
+
+		if (patterns_[p].obs_.size() == 0) {
+			return 0.; // all the coordinates are missing, the density is marginalized over the whole space
+		}
+
+		return class_[k].lnObservedDensity(p, i);
+	}
+
+	Index nbFreeParameter() const {
+		return nClass_ * class_[0].nParam();
+	}
+
+	void writeParameters() const {
+		std::stringstream sstm;
+		for (Index k = 0; k < nClass_; ++k) {
+			sstm << "Class: " << k << std::endl;
+			sstm << "mean: " << itString(class_[k].mean()) << std::endl;
+			sstm << "cov: " << std::endl << class_[k].cov() << std::endl;
+		}
+
+#ifdef MC_VERBOSE
+		std::cout << sstm.str() << std::endl;
+#endif
+	}
+
+	std::string setDataParam(RunMode mode) {
+		std::string warnLog;
+
+		if (dataG_.is_numeric_payload( { }, idName_)) {
+			return "Variable: " + idName_
+					+ " with MultivariateGaussian model is numeric, while each individual must be provided as a string containing the list of its coordinates separated by commas, for example \"1.2, 3.4\"."
+					+ eol;
+		}
+
+		std::vector<std::string> dataVecStr;
+		dataG_.get_payload( { }, idName_, dataVecStr);
+
+		NamedMatrix<Real> stat;
+		if (mode == prediction_) {
+			paramG_.get_payload( { idName_ }, "paramStr", paramStr_); // overwrite paramStr_ obtained from desc
+			paramG_.get_payload( { idName_ }, "stat", stat);
+		}
+
+		std::regex paramRe(std::string("nDim: *") + strPositiveInteger + std::string("(?:, *covariance: *(full|diagonal))?|covariance: *(full|diagonal)|"));
+		std::smatch matches;
+		if (std::regex_match(paramStr_, matches, paramRe)) {
+			nDim_ = (matches[1].matched) ? (str2type<Index>(matches[1].str())) : (0); // 0 means that nDim is deduced from the data
+			diagonal_ = matches[2].str() == "diagonal" || matches[3].str() == "diagonal";
+		} else {
+			return "Variable: " + idName_
+					+ " with MultivariateGaussian model has a parameter string which is not in the correct format, which should be \"nDim: x\", \"nDim: x, covariance: full\" or \"nDim: x, covariance: diagonal\", with x the number of coordinates. nDim can be omitted, and deduced from the data."
+					+ eol;
+		}
+
+		warnLog += parseMultivariateGaussianStr(dataVecStr, nDim_, data_);
+		if (warnLog.size() > 0) {
+			return "Variable: " + idName_ + " with MultivariateGaussian model has a problem with its data." + eol + warnLog;
+		}
+
+		if (nDim_ < 2) {
+			return "Variable: " + idName_ + " with MultivariateGaussian model requires at least 2 coordinates. If the individuals have a single coordinate, you must use a Gaussian model." + eol;
+		}
+
+		colMin_.resize(nDim_);
+		colMax_.resize(nDim_);
+		colMin_ = 0.;
+		colMax_ = 0.;
+		for (Index j = 0; j < nDim_; ++j) {
+			bool isObserved = false;
+			for (Index i = 0; i < nInd_; ++i) {
+				if (!std::isnan(data_(i, j))) {
+					colMin_(j) = (isObserved) ? (std::min(colMin_(j), data_(i, j))) : (data_(i, j));
+					colMax_(j) = (isObserved) ? (std::max(colMax_(j), data_(i, j))) : (data_(i, j));
+					isObserved = true;
+				}
+			}
+
+			if (!isObserved && mode == learning_) {
+				warnLog += "Variable: " + idName_ + " with MultivariateGaussian model has its coordinate " + std::to_string(j + minModality)
+						+ " missing for every individual, hence its distribution can not be estimated." + eol;
+			}
+		}
+
+		if (warnLog.size() > 0) {
+			return warnLog;
+		}
+
+		computeMissingPatterns(data_, patterns_, patternInd_);
+
+		augData_.resize(nDim_);
+		dataStat_.clear();
+		dataStat_.reserve(nDim_); // augData_ is not resized afterward, hence the references in dataStat_ stay valid
+		for (Index j = 0; j < nDim_; ++j) {
+			augData_[j].resizeArrays(nInd_);
+			for (Index i = 0; i < nInd_; ++i) {
+				if (std::isnan(data_(i, j))) {
+					augData_[j].setMissing(i, AugmentedData<Vector<Real> >::MisVal(missing_, std::vector<Real>()));
+				} else {
+					augData_[j].setPresent(i, data_(i, j));
+				}
+			}
+
+			dataStat_.emplace_back(augData_[j], confidenceLevel_);
+			dataStat_[j].setNbIndividual(nInd_);
+		}
+
+		for (Index k = 0; k < nClass_; ++k) {
+			class_[k].setSize(nDim_, diagonal_);
+		}
+
+		if (mode == prediction_) { // only the mode / expectation is used, quantile information is discarded
+			Index nParam = class_[0].nParam();
+			if (Index(stat.mat_.rows()) != nClass_ * nParam) {
+				return "Variable: " + idName_ + " with MultivariateGaussian model has " + std::to_string(stat.mat_.rows()) + " parameters, while " + std::to_string(nClass_ * nParam)
+						+ " are expected." + eol;
+			}
+
+			for (Index k = 0; k < nClass_; ++k) {
+				std::string classLog = class_[k].setParam(stat.mat_.col(0).segment(k * nParam, nParam));
+				if (0 < classLog.size()) {
+					warnLog += "Variable: " + idName_ + " with MultivariateGaussian model, error in class " + std::to_string(k) + "." + eol + classLog;
+				}
+				class_[k].setParamStorage();
+			}
+		}
+
+		paramStr_ = "nDim: " + std::to_string(nDim_) + ", covariance: " + ((diagonal_) ? ("diagonal") : ("full")); // paramStr is always completed, for future use and export for prediction
+
+		lnDensity_.resize(nInd_, nClass_);
+		cacheVersion_.assign(nClass_, 0);
+		if (mode == prediction_) {
+			refreshLnDensity();
+		}
+
+		return warnLog;
+	}
+
+	void exportDataParam(const OutputSelection& os) const {
+		if (os.completed_) {
+			NamedMatrix<Real> dataOut; // note that no row names are provided
+			dataOut.mat_ = data_;
+			outG_.add_payload( { "variable", "data", idName_ }, "completed", dataOut);
+		}
+
+		Index nParam = class_[0].nParam();
+		Index nStat = class_[0].paramStat().getStatStorage().cols();
+		std::vector<std::string> colNames;
+		quantileNames(nStat, confidenceLevel_, colNames);
+
+		NamedMatrix<Real> paramStatOut(nClass_ * nParam, nStat, false); // the linearized parameters of the classes are concatenated
+		paramStatOut.rowNames_ = paramNames();
+		paramStatOut.colNames_ = colNames;
+		for (Index k = 0; k < nClass_; ++k) {
+			paramStatOut.mat_.block(k * nParam, 0, nParam, nStat) = class_[k].paramStat().getStatStorage();
+		}
+
+		outG_.add_payload( { "variable", "param", idName_ }, "stat", paramStatOut);
+		outG_.add_payload( { "variable", "param", idName_ }, "paramStr", paramStr_);
+
+		if (os.paramLog_) {
+			Index nLog = class_[0].paramStat().getLogStorage().cols();
+			NamedMatrix<Real> paramLogOut(nClass_ * nParam, nLog, false);
+			paramLogOut.rowNames_ = paramNames();
+			for (Index k = 0; k < nClass_; ++k) {
+				paramLogOut.mat_.block(k * nParam, 0, nParam, nLog) = class_[k].paramStat().getLogStorage();
+			}
+			outG_.add_payload( { "variable", "param", idName_ }, "log", paramLogOut);
+		}
+	}
+
+	/**
+	 * The missing coordinates are sampled uniformly in the range of their observed values.
+	 */
+	void initData(Index i) {
+		const std::vector<Index>& mis = patterns_[patternInd_(i)].mis_;
+		for (std::vector<Index>::const_iterator it = mis.begin(), itE = mis.end(); it != itE; ++it) {
+			data_(i, *it) = uniform_.sample(colMin_(*it), colMax_(*it));
+		}
+		updateCacheRow(i);
+	}
+
+	void initParam() {
+		for (Index k = 0; k < nClass_; ++k) {
+			class_[k].initParam();
+		}
+		refreshLnDensity();
+	}
+
+	/**
+	 * The missing coordinates are sampled exactly from their conditional distribution, there is no Markov chain to initialize.
+	 */
+	void initializeMarkovChain(Index i, Index k) {
+	}
+
+	/**
+	 * The observed densities are computed exactly in lnObservedProbability.
+	 */
+	void computeObservedProba() {
+	}
+
+	bool sampleApproximationOfObservedProba() {
+		return false;
+	}
+
+private:
+	/**
+	 * Recompute the columns of lnDensity_ of the classes whose parameters changed since the last call, each with a single call to
+	 * MultivariateGaussianClass::lnDensity. It must be called serially, after each modification of the parameters.
+	 */
+	void refreshLnDensity() {
+		Vector<Real> logProba;
+		for (Index k = 0; k < nClass_; ++k) {
+			if (cacheVersion_[k] != class_[k].paramVersion()) {
+				class_[k].lnDensity(logProba);
+				lnDensity_.col(k) = logProba;
+				cacheVersion_[k] = class_[k].paramVersion();
+			}
+		}
+	}
+
+	/** Log density of individual i in class k, read from the cache. It is computed directly if the column has not been refreshed. */
+	Real lnDensity(Index i, Index k) const {
+		if (cacheVersion_[k] == class_[k].paramVersion()) {
+			return lnDensity_(i, k);
+		}
+
+		return class_[k].lnDensity(i);
+	}
+
+	/** Update the cached log densities of individual i after its data changed, in the classes whose cache is up to date. Each individual
+	 * only writes its own row, hence the individuals can be processed in parallel. */
+	void updateCacheRow(Index i) {
+		for (Index k = 0; k < nClass_; ++k) {
+			if (cacheVersion_[k] == class_[k].paramVersion()) {
+				lnDensity_(i, k) = class_[k].lnDensity(i);
+			}
+		}
+	}
+
+	std::vector<std::string> paramNames() const {
+		std::vector<std::string> names;
+		for (Index k = 0; k < nClass_; ++k) {
+			std::string classStr = "k: " + std::to_string(k + minModality);
+			for (Index j = 0; j < nDim_; ++j) {
+				names.push_back(classStr + ", mean: " + std::to_string(j + minModality));
+			}
+			for (Index j = 0; j < nDim_; ++j) {
+				if (diagonal_) {
+					names.push_back(classStr + ", cov: " + std::to_string(j + minModality) + ", " + std::to_string(j + minModality));
+				} else {
+					for (Index i = j; i < nDim_; ++i) {
+						names.push_back(classStr + ", cov: " + std::to_string(i + minModality) + ", " + std::to_string(j + minModality));
+					}
+				}
+			}
+		}
+		return names;
+	}
+
+	/** Number of coordinates */
+	Index nDim_;
+
+	bool diagonal_;
+
+	/** Confidence level used in computation of parameters and missing values statistics */
+	Real confidenceLevel_;
+
+	const Graph& dataG_;
+	const Graph& paramG_;
+	Graph& outG_;
+
+	std::string paramStr_;
+
+	/** Individuals in rows, coordinates in columns, the missing coordinates being completed by sampling */
+	Matrix<Real> data_;
+
+	std::vector<MissingPattern> patterns_;
+
+	/** Index in patterns_ of the missing pattern of each individual */
+	Vector<Index> patternInd_;
+
+	/** Range of the observed values of each coordinate, used in initData */
+	Vector<Real> colMin_;
+	Vector<Real> colMax_;
+
+	std::vector<MultivariateGaussianClass> class_;
+
+	/** Copy of each coordinate, used to compute the statistics on its missing values */
+	std::vector<AugmentedData<Vector<Real> > > augData_;
+
+	std::vector<ConfIntDataStat<Real> > dataStat_;
+
+	/** Log density of each individual (row) in each class (column) */
+	Matrix<Real> lnDensity_;
+
+	/** paramVersion of each class when its column of lnDensity_ was computed, 0 if it has not been computed */
+	std::vector<Index> cacheVersion_;
+
+	UniformStatistic uniform_;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANMIXTURE_H
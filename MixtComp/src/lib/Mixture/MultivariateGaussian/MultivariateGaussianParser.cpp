@@ -0,0 +1,123 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <boost/algorithm/string.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <map>
+
+#include <Various/Constants.h>
+#include "MultivariateGaussianParser.h"
+
+namespace mixt {
+
+std::string parseMultivariateGaussianStr(const std::vector<std::string>& dataStr, Index& nDim, Matrix<Real>& data) {
+	std::string warnLog;
+
+	Index nInd = dataStr.size();
+	std::vector<std::string> strs;
+
+	if (nDim == 0 && 0 < nInd) {
+		boost::split(strs, dataStr[0], boost::is_any_of(rankPosSep)); // same separator used as for values in Rank model
+		nDim = strs.size();
+	}
+
+	data.resize(nInd, nDim);
+
+	for (Index i = 0; i < nInd; ++i) {
+		boost::split(strs, dataStr[i], boost::is_any_of(rankPosSep));
+
+		if (strs.size() != nDim) {
+			std::stringstream sstm;
+			sstm << "Individual i: " << i << " has " << strs.size() << " coordinates instead of " << nDim << "." << std::endl;
+			warnLog += sstm.str();
+			continue;
+		}
+
+		for (Index j = 0; j < nDim; ++j) {
+			boost::trim(strs[j]);
+
+			if (strs[j] == "?") {
+				data(i, j) = std::numeric_limits<Real>::quiet_NaN();
+				continue;
+			}
+
+			char* end;
+			data(i, j) = std::strtod(strs[j].c_str(), &end); // the regex used for the other models is not needed to parse a real number
+			if (strs[j].size() == 0 || *end != '\0' || !std::isfinite(data(i, j))) {
+				std::stringstream sstm;
+				sstm << "Individual i: " << i << ", coordinate j: " << j << " present an error. " << strs[j]
+						<< " is not recognized as a valid format. Each coordinate must be a real number or ?." << std::endl;
+				warnLog += sstm.str();
+			}
+		}
+	}
+
+	return warnLog;
+}
+
+void computeMissingPatterns(const Matrix<Real>& data, std::vector<MissingPattern>& patterns, Vector<Index>& patternInd) {
+	Index nInd = data.rows();
+	Index nDim = data.cols();
+
+	patterns.assign(1, MissingPattern());
+	for (Index j = 0; j < nDim; ++j) {
+		patterns[0].obs_.push_back(j);
+	}
+	patternInd.resize(nInd);
+
+	std::map<std::vector<Index>, Index> index; // index in patterns of each set of missing coordinates
+	index[std::vector<Index>()] = 0;
+
+	std::vector<Index> mis;
+	for (Index i = 0; i < nInd; ++i) {
+		mis.clear();
+		for (Index j = 0; j < nDim; ++j) {
+			if (std::isnan(data(i, j))) {
+				mis.push_back(j);
+			}
+		}
+
+		std::map<std::vector<Index>, Index>::const_iterator it = index.find(mis);
+		if (it == index.end()) {
+			MissingPattern pattern;
+			pattern.mis_ = mis;
+			for (Index j = 0, m = 0; j < nDim; ++j) {
+				if (m < mis.size() && mis[m] == j) {
+					++m;
+				} else {
+					pattern.obs_.push_back(j);
+				}
+			}
+
+			it = index.insert(std::make_pair(mis, patterns.size())).first;
+			patterns.push_back(pattern);
+		}
+
+		patternInd(i) = it->second;
+		patterns[it->second].ind_.push_back(i);
+	}
+}
+
+} // namespace mixt
@@ -0,0 +1,68 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANPARSER_H
+#define LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANPARSER_H
+
+#include <string>
+#include <vector>
+#include <LinAlg/LinAlg.h>
+
+namespace mixt {
+
+/**
+ * Individuals sharing the same set of missing coordinates. The conditional distributions of the missing coordinates given the observed
+ * ones only depend on the pattern and on the class, and are computed once per pattern and class each time the parameters change.
+ */
+struct MissingPattern {
+	/** Missing coordinates, in increasing order. */
+	std::vector<Index> mis_;
+
+	/** Observed coordinates, in increasing order. */
+	std::vector<Index> obs_;
+
+	/** Individuals with this pattern. */
+	std::vector<Index> ind_;
+};
+
+/**
+ * Parse the data of a MultivariateGaussian variable. Each individual is a list of nDim coordinates separated by commas, each coordinate
+ * being a real number or ? if it is missing. Missing coordinates are set to nan in data.
+ *
+ * @param[in, out] nDim number of coordinates, deduced from the first individual if 0
+ * @param[out] data individuals in rows, coordinates in columns
+ * @return empty string if no errors, otherwise errors description
+ */
+std::string parseMultivariateGaussianStr(const std::vector<std::string>& dataStr, Index& nDim, Matrix<Real>& data);
+
+/**
+ * Group the individuals by missing pattern. The first pattern is the one without missing coordinates, even if it contains no individual.
+ *
+ * @param data individuals in rows, with nan for the missing coordinates
+ * @param[out] patternInd index in patterns of the pattern of each individual
+ */
+void computeMissingPatterns(const Matrix<Real>& data, std::vector<MissingPattern>& patterns, Vector<Index>& patternInd);
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_MULTIVARIATEGAUSSIAN_MULTIVARIATEGAUSSIANPARSER_H
@@ -1,5 +1,18 @@
-/* MixtComp version 2.0  - 13 march 2017
- * Copyright (C) Inria - Lille 1 */
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
 
 /*
  *  Project:    MixtComp
@@ -7,25 +20,25 @@
  *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
-#include "../model Ordinal/mixt_BOSNode.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include "BOSNode.h"
 
 namespace mixt {
 
 void BOSNode::partition(const Vector<int, 2>& e) {
 	if (y_ < e(0) || y_ > e(1)) { // if y is not in the interval, the partition is empty
 		partSize_ = 0;
-		part_.resize(partSize_);
 	} else {
 		partSize_ = 3; // maximum size of the partition
 		int yPos; // position of the "breaking point" segment
-		if (e(0) == y_) // is the left segment empty ?
-				{
+		if (e(0) == y_) { // is the left segment empty ?
 			partSize_ -= 1;
 		}
 		if (e(1) == y_) { // is the right segment empty ?
 			partSize_ -= 1;
 		}
-		part_.resize(partSize_);
 
 		if (e(0) != y_) { // is the left interval non-empty ? If not, partition element will be an empty vector
 			part_(0)(0) = e(0);
@@ -47,12 +60,25 @@ void BOSNode::partition(const Vector<int, 2>& e) {
 }
 
 bool BOSNode::isInPart(const Vector<int, 2>& e) const {
-	bool isIn = false;
 	for (int i = 0; i < partSize_; ++i) {
 		if (e == part_(i))
-			isIn = true;
+			return true;
+	}
+	return false;
+}
+
+int BOSNode::closestPart(int mu) const {
+	int closestSegment = -1; // index in partition of the closest segment
+	int disClosestSegment = 0; // distance between mu and closest segment
+	for (int s = 0; s < partSize_; ++s) { // loop on all segments of the partition
+		int disCurrSegment = std::min(std::abs(mu - part_(s)(0)), std::abs(mu - part_(s)(1))); // distance of current segment to the mode
+		if (s == 0 || disCurrSegment < disClosestSegment) { // for the first segment, or if a new closest segment has been detected
+			closestSegment = s;
+			disClosestSegment = disCurrSegment;
+		}
 	}
-	return isIn;
+
+	return closestSegment;
 }
 
 Real BOSNode::yLogProba(const Vector<int, 2>& e) const {
@@ -76,21 +102,11 @@ Real BOSNode::zLogProba(Real pi) const {
 	return std::log(zProba);
 }
 
-Real BOSNode::eLogProba(int mu, Real pi) const {
+Real BOSNode::eLogProba(int mu) const {
 	Real eProba;
 
 	if (z_ == 1) { // comparison is perfect, and only the best segment has a nonzero probability
-		int closestSegment = -1; // index in partition of the closest segment
-		Real disClosestSegment; // distance between mu and closest segment
-		for (int s = 0; s < partSize_; ++s) { // loop on all segments of the partition
-			Real disCurrSegment = std::min(std::abs(mu - part_(s)(0)), // distance of current segment to the mode
-			std::abs(mu - part_(s)(1)));
-			if (s == 0 || disCurrSegment < disClosestSegment) // for the first segment, or if a new closest segment has been detected
-					{
-				closestSegment = s;
-				disClosestSegment = disCurrSegment;
-			}
-		}
+		int closestSegment = closestPart(mu);
 
 		if (closestSegment > -1 && e_ == part_(closestSegment)) { // a closest segment exists, and e points to it
 			eProba = 1.;
@@ -100,15 +116,13 @@ Real BOSNode::eLogProba(int mu, Real pi) const {
 	} else { // comparison is blind, and proba is based on sizes of segments
 		int sizePart = 0; // total size of the partition
 		eProba = 0.; // by default the segment is assumed absent from the partition, and hence having a null probability
-		for (int s = 0; s < partSize_; ++s) // loop on all segments of the partition
-				{
+		for (int s = 0; s < partSize_; ++s) { // loop on all segments of the partition
 			sizePart += part_(s)(1) - part_(s)(0) + 1;
 			if (e_ == part_(s)) { // computation of probability for current e_
-
 				eProba = Real(part_(s)(1) - part_(s)(0) + 1);
 			}
 		}
-		if (sizePart > 0) { // the case sizePart = 0 means that y was not in the segment e of the previous iteration. Case is possible during a Gibbs sampling.
+		if (sizePart > 0) { // the case sizePart = 0 means that y was not in the segment e of the previous iteration
 			eProba /= Real(sizePart);
 		} else {
 			eProba = 0.;
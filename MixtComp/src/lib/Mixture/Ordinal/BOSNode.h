@@ -0,0 +1,82 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: April 29, 2015
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_ORDINAL_BOSNODE_H
+#define LIB_MIXTURE_ORDINAL_BOSNODE_H
+
+#include <LinAlg/LinAlg.h>
+
+namespace mixt {
+
+/**
+ * Structure containing the values of an iteration of the BOS algorithm.
+ * A node contains information on:
+ * - breaking point y
+ * - blindness of comparison z
+ * - final segment e
+ *
+ * The partition has at most three segments, and is stored in a fixed size array to avoid allocations when paths are sampled.
+ */
+class BOSNode {
+public:
+	int y_; // breaking point
+	Vector<Vector<int, 2>, 3> part_; // partition is uniquely defined by e_ from previous iteration and by y_, only the partSize_ first elements are used
+	int partSize_; // number of elements in the partition
+	int z_; // blindness of comparison
+	Vector<int, 2> e_; // final segment for current iteration, as an index of the partition
+
+	/**
+	 * Compute the partition of a segment, using the breaking point y_ of the node
+	 *
+	 * @param e segment to be partitioned
+	 */
+	void partition(const Vector<int, 2>& e);
+
+	/**
+	 * Check if a segment is a member of the partition
+	 *
+	 * @param e segment which presence should be checked
+	 */
+	bool isInPart(const Vector<int, 2>& e) const;
+
+	/**
+	 * Index in the partition of the segment selected by a perfect comparison, which is the closest to the mode. In case of a tie, the first segment
+	 * is selected.
+	 *
+	 * @param mu localization parameter (mode) of the distribution
+	 */
+	int closestPart(int mu) const;
+
+	Real yLogProba(const Vector<int, 2>& e) const;
+	Real zLogProba(Real pi) const;
+
+	/**
+	 * Compute the probability of the current segment conditionally to the partition and y of the node
+	 *
+	 * @param mu localization parameter (mode) of the distribution
+	 */
+	Real eLogProba(int mu) const;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_ORDINAL_BOSNODE_H
@@ -0,0 +1,196 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: March 23, 2015
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include <Various/Constants.h>
+#include "BOSPath.h"
+
+namespace mixt {
+
+BOSPath::BOSPath() :
+		nbNode_(0), nbZ_(0), allZ_(allZ0_), muMin_(0), muMax_(-1), logProbaBlind_(0.) {
+	eInit_ << 0, 0;
+	endCond_ << 0, 0;
+}
+
+void BOSPath::setInit(int a, int b) {
+	eInit_(0) = a;
+	eInit_(1) = b;
+	nbNode_ = eInit_(1) - eInit_(0); // number of segments in the path;
+	c_.resize(nbNode_);
+	weight_.resize(6 * (eInit_(1) - eInit_(0) + 1)); // y, z and the index in the partition of e for each candidate value of a node
+}
+
+void BOSPath::setEnd(int a, int b) {
+	endCond_(0) = a;
+	endCond_(1) = b;
+}
+
+void BOSPath::setC(const Vector<BOSNode>& c) {
+	c_ = c;
+	computeStat();
+}
+
+Real BOSPath::computeLogProba(int mu, Real pi) const {
+	Real logProba = 0.; // The initial probability of being in any of the member of the input interval is 1
+
+	int lastSeg = c_(nbNode_ - 1).e_(0); // last segment only contains one element
+	if (endCond_(0) <= lastSeg && lastSeg <= endCond_(1)) { // is the path compatible with the provided condition ?
+		for (int node = 0; node < nbNode_; ++node) { // loop over each BOSNode in c
+			Real yLogProba;
+			if (node == 0) {
+				yLogProba = c_(node).yLogProba(eInit_); // yProba based on initial segment
+			} else {
+				yLogProba = c_(node).yLogProba(c_(node - 1).e_); // yProba based on previous iteration segment
+			}
+			Real zLogProba = c_(node).zLogProba(pi);
+			Real eLogProba = c_(node).eLogProba(mu);
+			logProba += yLogProba + zLogProba + eLogProba;
+		}
+	} else { // conditional probability of verifying condition given the path is null
+		logProba = minInf;
+	}
+
+	return logProba;
+}
+
+Real BOSPath::computeLogProba(const BOSTable& table) const {
+	int lastSeg = c_(nbNode_ - 1).e_(0);
+	if (lastSeg < endCond_(0) || endCond_(1) < lastSeg || table.mu() < muMin_ || muMax_ < table.mu()) {
+		return minInf;
+	}
+
+	Real logProba = logProbaBlind_;
+	if (0 < nbZ_) { // tested to avoid 0 * log(0) when pi is 0 or 1
+		logProba += nbZ_ * table.logPi();
+	}
+	if (nbZ_ < nbNode_) {
+		logProba += (nbNode_ - nbZ_) * table.logOneMinusPi();
+	}
+
+	return logProba;
+}
+
+void BOSPath::samplePath(const BOSTable& table) {
+	int mu = table.mu();
+	Real pi = table.pi();
+	Vector<int, 2> seg = eInit_;
+
+	for (int n = 0; n < nbNode_; ++n) {
+		BOSNode& currNode = c_(n);
+		Real size = seg(1) - seg(0) + 1;
+		int nbCandidate = 6 * (seg(1) - seg(0) + 1);
+
+		for (currNode.y_ = seg(0); currNode.y_ < seg(1) + 1; ++currNode.y_) { // the uniform probability of y is common to all candidates
+			currNode.partition(seg);
+			int closestSegment = currNode.closestPart(mu);
+			int firstCandidate = 6 * (currNode.y_ - seg(0));
+
+			for (int p = 0; p < 3; ++p) {
+				if (p < currNode.partSize_) {
+					const Vector<int, 2>& e = currNode.part_(p);
+					Real probaEnd = table.probaInterval(e(0), e(1), endCond_(0), endCond_(1)); // probability that the rest of the path verifies the end condition
+					weight_(firstCandidate + p) = (1. - pi) * (e(1) - e(0) + 1) / size * probaEnd; // z = 0
+					weight_(firstCandidate + 3 + p) = (p == closestSegment) ? pi * probaEnd : 0.; // z = 1
+				} else {
+					weight_(firstCandidate + p) = 0.;
+					weight_(firstCandidate + 3 + p) = 0.;
+				}
+			}
+		}
+
+		weight_.head(nbCandidate) /= weight_.head(nbCandidate).sum();
+		int candidate = multi_.sample(weight_.head(nbCandidate));
+
+		currNode.y_ = seg(0) + candidate / 6;
+		currNode.partition(seg);
+		currNode.z_ = (candidate % 6) / 3;
+		currNode.e_ = currNode.part_(candidate % 3);
+
+		seg = currNode.e_;
+	}
+
+	computeStat();
+}
+
+void BOSPath::forwardSamplePath(int mu, Real pi) {
+	Vector<int, 2> seg = eInit_;
+
+	for (int n = 0; n < nbNode_; ++n) {
+		BOSNode& currNode = c_(n);
+
+		currNode.y_ = multi_.sampleInt(seg(0), seg(1));
+		currNode.partition(seg);
+
+		currNode.z_ = multi_.sampleBinomial(pi);
+
+		for (int e = 0; e < currNode.partSize_; ++e) {
+			currNode.e_ = currNode.part_(e);
+			weight_(e) = std::exp(currNode.eLogProba(mu));
+		}
+		currNode.e_ = currNode.part_(multi_.sample(weight_.head(currNode.partSize_)));
+
+		seg = currNode.e_;
+	}
+
+	computeStat();
+}
+
+void BOSPath::computeStat() {
+	nbZ_ = 0;
+	muMin_ = eInit_(0);
+	muMax_ = eInit_(1);
+	logProbaBlind_ = 0.;
+
+	for (int node = 0; node < nbNode_; ++node) {
+		const BOSNode& currNode = c_(node);
+		logProbaBlind_ += currNode.yLogProba((node == 0) ? eInit_ : c_(node - 1).e_);
+
+		if (currNode.z_ == 1) {
+			nbZ_ += 1;
+
+			if (!currNode.isInPart(currNode.e_)) { // no mode can select a segment outside of the partition
+				muMax_ = muMin_ - 1;
+			} else { // the segments of the partition are contiguous, the mode selects the segment containing it, or the first or last if it is outside of the partition
+				if (currNode.e_ != currNode.part_(0)) {
+					muMin_ = std::max(muMin_, currNode.e_(0));
+				}
+				if (currNode.e_ != currNode.part_(currNode.partSize_ - 1)) {
+					muMax_ = std::min(muMax_, currNode.e_(1));
+				}
+			}
+		} else {
+			logProbaBlind_ += currNode.eLogProba(0); // a blind comparison does not use mu
+		}
+	}
+
+	if (nbZ_ == 0) {
+		allZ_ = allZ0_;
+	} else if (nbZ_ == nbNode_) {
+		allZ_ = allZ1_;
+	} else {
+		allZ_ = mixZ0Z1_;
+	}
+}
+
+} // namespace mixt
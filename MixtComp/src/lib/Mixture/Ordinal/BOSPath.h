@@ -0,0 +1,149 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: March 23, 2015
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_ORDINAL_BOSPATH_H
+#define LIB_MIXTURE_ORDINAL_BOSPATH_H
+
+#include <Statistic/MultinomialStatistic.h>
+#include "BOSNode.h"
+#include "BOSTable.h"
+
+namespace mixt {
+
+enum allZ {
+	allZ0_, allZ1_, mixZ0Z1_
+};
+
+class BOSPath {
+public:
+	BOSPath();
+
+	void setInit(int a, int b);
+	void setEnd(int a, int b);
+
+	/**
+	 * Used for debug / test, because in a standard run, the path is sampled using samplePath
+	 * */
+	void setC(const Vector<BOSNode>& c);
+
+	/**
+	 * Joint probability on the whole BOSPath (path + end condition), computed node by node
+	 *
+	 * @param mu localization parameter (mode) of the distribution
+	 * @param pi precision parameter of the distribution
+	 * @return joint probability
+	 * */
+	Real computeLogProba(int mu, Real pi) const;
+
+	/**
+	 * Joint probability on the whole BOSPath (path + end condition), computed in constant time from the statistics cached when the path
+	 * was last modified, and from the parameters of the table.
+	 * */
+	Real computeLogProba(const BOSTable& table) const;
+
+	/**
+	 * Sample the complete path from its distribution conditional to the end condition, using the parameters of the table. Each node is sampled
+	 * forward, the probability of each value of (y, z, e) being weighted by the probability that a search process at e ends inside the end
+	 * condition. The resulting path does not depend on the previous one, hence there is no Markov chain to initialize.
+	 *
+	 * @param table probabilities precomputed for the parameters of the class
+	 */
+	void samplePath(const BOSTable& table);
+
+	/**
+	 * Overwrite the complete path by sampling everything, without taking the end condition into account.
+	 *
+	 * @param mu localization parameter (mode) of the distribution
+	 * @param pi precision parameter of the distribution
+	 */
+	void forwardSamplePath(int mu, Real pi);
+
+	/**
+	 * Check if all the z in the path are at 1 or not
+	 * */
+	enum allZ allZ() const {
+		return allZ_;
+	}
+
+	/** Compute the number of z at 1 in path_
+	 * */
+	int nbZ() const {
+		return nbZ_;
+	}
+
+	/** Bounds of the modes mu for which the perfect comparisons of the path select the segments that they selected. The completed probability
+	 * of the path is null for the other modes, and does not depend on the mode inside these bounds. */
+	int muMin() const {
+		return muMin_;
+	}
+
+	int muMax() const {
+		return muMax_;
+	}
+
+	/** Final value of the path */
+	int x() const {
+		return c_(nbNode_ - 1).e_(0);
+	}
+
+	const Vector<int, 2>& eInit() const {
+		return eInit_;
+	}
+	const Vector<BOSNode>& c() const {
+		return c_;
+	}
+	const Vector<int, 2>& endCond() const {
+		return endCond_;
+	}
+
+	int nbNode() const {
+		return nbNode_;
+	}
+
+private:
+	/** Compute nbZ_, allZ_, muMin_, muMax_ and logProbaBlind_ */
+	void computeStat();
+
+	MultinomialStatistic multi_;
+
+	Vector<int, 2> eInit_;
+	Vector<BOSNode> c_;
+	Vector<int, 2> endCond_;
+
+	int nbNode_;
+	int nbZ_;
+
+	enum allZ allZ_;
+
+	int muMin_;
+	int muMax_;
+
+	/** Sum of the log probabilities of the breaking points and of the segments selected by blind comparisons, which depend on neither mu nor pi */
+	Real logProbaBlind_;
+
+	/** Weights of the candidate values of a node in samplePath, stored here to avoid an allocation per node */
+	Vector<Real> weight_;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_ORDINAL_BOSPATH_H
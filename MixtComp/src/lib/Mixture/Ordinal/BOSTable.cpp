@@ -0,0 +1,94 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include "BOSNode.h"
+#include "BOSTable.h"
+
+namespace mixt {
+
+BOSTable::BOSTable() :
+		nbModality_(0), mu_(0), pi_(0.), logPi_(0.), logOneMinusPi_(0.) {
+}
+
+void BOSTable::compute(int nbModality, int mu, Real pi) {
+	nbModality_ = nbModality;
+	mu_ = mu;
+	pi_ = pi;
+	logPi_ = std::log(pi);
+	logOneMinusPi_ = std::log(1. - pi);
+
+	proba_.resize(nbModality_, nbModality_ * nbModality_);
+	proba_ = 0.;
+
+	BOSNode node;
+	Vector<int, 2> e;
+	for (int a = 0; a < nbModality_; ++a) { // a search process at a single modality can only end there
+		proba_(a, segIndex(a, a)) = 1.;
+	}
+
+	for (int size = 2; size < nbModality_ + 1; ++size) { // the partitions of a segment only contain smaller segments, which have already been computed
+		for (int a = 0; a < nbModality_ - size + 1; ++a) {
+			e << a, a + size - 1;
+			int s = segIndex(e(0), e(1));
+
+			for (node.y_ = e(0); node.y_ < e(1) + 1; ++node.y_) { // y is uniform in e, the 1 / size factor is applied at the end
+				node.partition(e);
+				int closestSegment = node.closestPart(mu_);
+
+				for (int p = 0; p < node.partSize_; ++p) {
+					Real partSize = node.part_(p)(1) - node.part_(p)(0) + 1;
+					Real w = (1. - pi_) * partSize / Real(size); // blind comparison, segment proportional to its size
+					if (p == closestSegment) {
+						w += pi_; // perfect comparison
+					}
+
+					proba_.col(s) += w * proba_.col(segIndex(node.part_(p)(0), node.part_(p)(1)));
+				}
+			}
+
+			proba_.col(s) /= Real(size);
+		}
+	}
+
+	cumProba_.resize(nbModality_ + 1, nbModality_ * nbModality_);
+	cumProba_.row(0).setZero();
+	for (int x = 0; x < nbModality_; ++x) {
+		cumProba_.row(x + 1) = cumProba_.row(x) + proba_.row(x);
+	}
+}
+
+Real BOSTable::probaInterval(int a, int b, int l, int u) const {
+	int s = segIndex(a, b);
+	if (l == u) { // most frequent case, when the value is observed, a subtraction of cumulated probabilities would lose precision
+		return proba_(l, s);
+	}
+
+	return std::max(0., cumProba_(u + 1, s) - cumProba_(l, s));
+}
+
+Real BOSTable::lnObservedProbability(int l, int u) const {
+	return std::log(probaInterval(0, nbModality_ - 1, l, u));
+}
+
+} // namespace mixt
@@ -0,0 +1,100 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_ORDINAL_BOSTABLE_H
+#define LIB_MIXTURE_ORDINAL_BOSTABLE_H
+
+#include <LinAlg/LinAlg.h>
+
+namespace mixt {
+
+/**
+ * Probabilities of the BOS model precomputed for a given pair of parameters mu and pi.
+ *
+ * Each node of a path strictly reduces its segment until it contains a single modality, which is then kept by the following nodes. The
+ * probability that a search process currently at segment e ends at x therefore does not depend on the number of remaining nodes. It is
+ * computed for every segment by increasing size, so that the observed probabilities are obtained without sampling, and that the paths
+ * can be sampled exactly conditionally to their end condition (see BOSPath::samplePath).
+ */
+class BOSTable {
+public:
+	BOSTable();
+
+	/**
+	 * Compute the table for the given parameters. The cost is O(nbModality^4), and the table is meant to be computed once per class each
+	 * time the parameters are modified.
+	 */
+	void compute(int nbModality, int mu, Real pi);
+
+	int nbModality() const {
+		return nbModality_;
+	}
+
+	int mu() const {
+		return mu_;
+	}
+
+	Real pi() const {
+		return pi_;
+	}
+
+	Real logPi() const {
+		return logPi_;
+	}
+
+	Real logOneMinusPi() const {
+		return logOneMinusPi_;
+	}
+
+	/** Probability that a search process at segment [a, b] ends at x. */
+	Real proba(int a, int b, int x) const {
+		return proba_(x, segIndex(a, b));
+	}
+
+	/** Probability that a search process at segment [a, b] ends in the interval [l, u]. */
+	Real probaInterval(int a, int b, int l, int u) const;
+
+	/** Log probability of the observed interval [l, u], starting from the segment containing all the modalities. */
+	Real lnObservedProbability(int l, int u) const;
+
+private:
+	int segIndex(int a, int b) const {
+		return a * nbModality_ + b;
+	}
+
+	int nbModality_;
+	int mu_;
+	Real pi_;
+	Real logPi_;
+	Real logOneMinusPi_;
+
+	/** Final values in rows, segments in columns indexed by segIndex, so that the distribution of each segment is contiguous. Columns of
+	 * invalid segments, with b < a, are not used. */
+	Matrix<Real> proba_;
+
+	/** Cumulated proba_ along the columns, the row x containing the probability to end strictly below x. */
+	Matrix<Real> cumProba_;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_ORDINAL_BOSTABLE_H
@@ -0,0 +1,481 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: May 22, 2015
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#ifndef LIB_MIXTURE_ORDINAL_ORDINALMIXTURE_H
+#define LIB_MIXTURE_ORDINAL_ORDINALMIXTURE_H
+
+#include <algorithm>
+#include <regex>
+#include <set>
+#include <vector>
+#include <Data/AugmentedData.h>
+#include <Data/ConfIntDataStat.h>
+#include <IO/IOFunctions.h>
+#include <IO/NamedAlgebra.h>
+#include <IO/SpecialStr.h>
+#include <Mixture/IMixture.h>
+#include <Param/ConfIntParamStat.h>
+#include <Various/Constants.h>
+#include "BOSPath.h"
+#include "BOSTable.h"
+
+namespace mixt {
+
+/**
+ * Ordinal data described by the BOS model. Each observation is the result of a search process (a BOSPath) in the ordered modalities, parameterized
+ * by a mode mu and a precision pi in each class.
+ *
+ * The probabilities of the model are precomputed in a BOSTable per class, each time the parameters change. The observed probabilities are read
+ * from it, and the paths are sampled exactly from their conditional distribution instead of by a Gibbs sampler. The completed probability of a
+ * path is obtained in constant time from statistics cached in the path, which are also used to estimate pi. The mode is estimated
+ * from the observed probabilities, see mStepMu.
+ */
+template<typename Graph>
+class OrdinalMixture: public IMixture {
+public:
+	OrdinalMixture(const Graph& data, const Graph& param, Graph& out, std::string const& idName, Index nClass, Index nInd, Real confidenceLevel, const std::string& paramStr) :
+			IMixture(idName, "Ordinal", nClass, nInd), nbModality_(0), confidenceLevel_(confidenceLevel), dataG_(data), paramG_(param), outG_(out), mu_(nClass), pi_(nClass), table_(nClass), dataStat_(
+					augData_, confidenceLevel), muParamStat_(mu_, confidenceLevel), piParamStat_(pi_, confidenceLevel), paramStr_(paramStr) {
+		acceptedType_.resize(nb_enum_MisType_);
+		acceptedType_ << true,   // present_,
+		true,  // missing_,
+		false,  // missingFiniteValues_,
+		true,  // missingIntervals_,
+		false,  // missingLUIntervals_,
+		false; // missingRUIntervals
+	}
+
+	const Vector<int>& mu() const {
+		return mu_;
+	}
+
+	const Vector<Real>& pi() const {
+		return pi_;
+	}
+
+	void sampleUnobservedAndLatent(Index i, Index k) {
+		path_(i).samplePath(table_[k]);
+		augData_.data_(i) = path_(i).x();
+	}
+
+	std::string checkSampleCondition(const Vector<std::set<Index> >& classInd) const {
+		if (degeneracyAuthorizedForNonBoundedLikelihood)
+			return "";
+
+		for (Index k = 0; k < nClass_; ++k) {
+			bool allZ0 = true; // are all z = 0 in the current class ?
+			bool allZ1 = true; // are all z = 1 in the current class ?
+			for (std::set<Index>::const_iterator it = classInd(k).begin(), itE = classInd(k).end(); it != itE; ++it) {
+				switch (path_(*it).allZ()) { // what can be deduced from the current path ?
+				case allZ0_: {
+					allZ1 = false;
+				}
+					break;
+
+				case allZ1_: {
+					allZ0 = false;
+				}
+					break;
+
+				case mixZ0Z1_: { // this ensure an immediate end of testing
+					allZ0 = false;
+					allZ1 = false;
+				}
+					break;
+				}
+
+				if (allZ0 == false && allZ1 == false) { // there is enough variability on z in this class to ensure that pi will be estimated inside the open support
+					goto itKEnd;
+				}
+			}
+
+			return "Error in variable: " + idName_
+					+ " with Ordinal model. A latent variable (the accuracy z) is uniformly 0 or 1 in at least one class. If the number of modalities is quite low, try using a categorical model instead."
+					+ eol;
+
+			itKEnd: ; // jumping here means that the return above is skipped, for the current class
+		}
+
+		return "";
+	}
+
+	std::string mStep(const Vector<std::set<Index> >& classInd) {
+		for (Index k = 0; k < nClass_; ++k) {
+			int lastMu = mu_(k);
+			mStepMu(classInd(k), k);
+			mStepPi(classInd(k), k); // before the paths are sampled again, as checkSampleCondition has been performed on the current paths
+			table_[k].compute(nbModality_, mu_(k), pi_(k));
+			if (mu_(k) != lastMu) { // the paths sampled with the previous mode can have a null probability with the new one
+				for (std::set<Index>::const_iterator it = classInd(k).begin(), itEnd = classInd(k).end(); it != itEnd; ++it) {
+					sampleUnobservedAndLatent(*it, k);
+				}
+			}
+		}
+
+		return "";
+	}
+
+	void storeSEMRun(Index iteration, Index iterationMax) {
+		muParamStat_.sampleParam(iteration, iterationMax);
+		piParamStat_.sampleParam(iteration, iterationMax);
+
+		if (iteration == iterationMax) {
+			muParamStat_.setExpectationParam(); // estimate mu parameter using mode / expectation
+			piParamStat_.setExpectationParam(); // estimate pi parameter using mode / expectation
+			computeTable();
+		}
+	}
+
+	void storeGibbsRun(Index i, Index iteration, Index iterationMax) {
+		dataStat_.sampleVals(i, iteration, iterationMax);
+		if (iteration == iterationMax) {
+			dataStat_.imputeData(i); // impute the missing values using empirical median
+		}
+	}
+
+	Real lnCompletedProbability(Index i, Index k) const {
+		return path_(i).computeLogProba(table_[k]);
+	}
+
+	Real lnObservedProbability(Index i, Index k) const {
+		return lnObservedProbability(i, table_[k]);
+	}
+
+	Index nbFreeParameter() const {
+		return nClass_; // only the continuous pi_ parameter is taken into account, not the discrete mu_ parameter
+	}
+
+	void writeParameters() const {
+		std::stringstream sstm;
+		for (Index k = 0; k < nClass_; ++k) {
+			sstm << "Class: " << k << std::endl;
+			sstm << "mu: " << mu_(k) << std::endl;
+			sstm << "pi: " << pi_(k) << std::endl;
+		}
+
+#ifdef MC_VERBOSE
+		std::cout << sstm.str() << std::endl;
+#endif
+	}
+
+	std::string setDataParam(RunMode mode) {
+		std::string warnLog;
+
+		if (dataG_.is_numeric_payload( { }, idName_)) { // numeric columns are read directly, without string parsing
+			Vector<Real> dataVecNum;
+			dataG_.get_payload( { }, idName_, dataVecNum);
+			warnLog += NumericToAugmentedData(idName_, dataVecNum, augData_, -minModality); // ordinal data are modalities, offset enforces 0-based encoding through the whole mixture
+		} else {
+			std::vector<std::string> dataVecStr;
+			dataG_.get_payload( { }, idName_, dataVecStr);
+			warnLog += StringToAugmentedData(idName_, dataVecStr, augData_, -minModality);
+		}
+
+		if (warnLog.size() > 0) {
+			return warnLog;
+		}
+
+		augData_.computeRange();
+		std::string missingLog = augData_.checkMissingType(acceptedType_); // check if the missing data provided are compatible with the model
+
+		if (missingLog.size() > 0) {
+			std::stringstream sstm;
+			sstm << "Variable " << idName_ << " with Ordinal model has a problem with the descriptions of missing values." << std::endl << missingLog;
+			warnLog += sstm.str();
+		}
+
+		if (mode == prediction_) {
+			paramG_.get_payload( { idName_ }, "paramStr", paramStr_); // overwrite paramStr_ obtained from desc
+
+			NamedMatrix<Real> stat;
+			paramG_.get_payload( { idName_ }, "stat", stat);
+			for (Index k = 0; k < nClass_; ++k) { // only the mode / expectation is used, quantile information is discarded
+				mu_(k) = int(stat.mat_(2 * k, 0)) - minModality;
+				pi_(k) = stat.mat_(2 * k + 1, 0);
+			}
+
+			muParamStat_.setParamStorage();
+			piParamStat_.setParamStorage();
+		}
+
+		if (paramStr_.size() == 0) { // no paramStr_ provided in learning, parameters space is deduced from data
+			nbModality_ = augData_.dataRange_.max_ + 1;
+			paramStr_ = "nModality: " + std::to_string(nbModality_); // paramStr must be generated from the data, for future use and export for prediction
+		} else {
+			std::string nModStr = std::string("nModality: *") + strPositiveInteger;
+			std::regex nModRe(nModStr);
+			std::smatch matchesVal;
+
+			if (std::regex_match(paramStr_, matchesVal, nModRe)) { // value is present
+				nbModality_ = str2type<int>(matchesVal[1].str());
+			} else {
+				std::stringstream sstm;
+				sstm << "Variable: " << idName_ << " parameter string is not in the correct format, which should be \"nModality: x\" " << "with x the number of modalities in the variable."
+						<< std::endl;
+				warnLog += sstm.str();
+			}
+
+			if (nbModality_ <= augData_.dataRange_.max_) {
+				std::stringstream sstm;
+				sstm << "Variable: " << idName_ << " requires a maximum value of : " << nbModality_ - 1 + minModality << " in either provided values or bounds. "
+						<< "The maximum currently provided value is : " << augData_.dataRange_.max_ + minModality << std::endl;
+				warnLog += sstm.str();
+			}
+		}
+
+		if (augData_.dataRange_.min_ < 0) { // modality encoding is 0-based, so in any case, values below 0 are erroneous
+			std::stringstream sstm;
+			sstm << "Variable: " << idName_ << " requires a minimum value of : " << minModality << " in either provided values or bounds. " << "The minimum value currently provided is : "
+					<< augData_.dataRange_.min_ + minModality << std::endl;
+			warnLog += sstm.str();
+		}
+
+		if (nbModality_ < 3) {
+			std::stringstream sstm;
+			sstm << "Variable: " << idName_ << " requires a minimum of 3 modalities. If you have less modalities than that, you must use a Multinomial model." << std::endl;
+			warnLog += sstm.str();
+		}
+
+		if (warnLog.size() > 0) {
+			return warnLog;
+		}
+
+		augData_.dataRange_.min_ = 0; // once everything has been set, adjust the range of data to align with the parameter space
+		augData_.dataRange_.max_ = nbModality_ - 1;
+		augData_.dataRange_.range_ = nbModality_;
+
+		setPath();
+		dataStat_.setNbIndividual(nInd_);
+
+		initTable_.compute(nbModality_, (nbModality_ - 1) / 2, piInitBOS); // parameters used to initialize the paths, before any mStep
+		if (mode == prediction_) {
+			computeTable();
+		}
+
+		return warnLog;
+	}
+
+	void exportDataParam(const OutputSelection& os) const {
+		if (os.completed_) {
+			NamedVector<int> dataOut;
+			dataOut.vec_ = augData_.data_; // note that no row names are provided
+			dataOut.vec_ += minModality;
+			outG_.add_payload( { "variable", "data", idName_ }, "completed", dataOut);
+		}
+
+		Index nStat = muParamStat_.getStatStorage().cols();
+		std::vector<std::string> colNames;
+		quantileNames(nStat, confidenceLevel_, colNames);
+
+		NamedMatrix<Real> paramStatOut(2 * nClass_, nStat, false); // mu and pi are aggregated in a single matrix, class by class
+		paramStatOut.rowNames_ = paramNames();
+		paramStatOut.colNames_ = colNames;
+		for (Index k = 0; k < nClass_; ++k) {
+			for (Index j = 0; j < nStat; ++j) {
+				paramStatOut.mat_(2 * k, j) = muParamStat_.getStatStorage()(k, j) + minModality;
+				paramStatOut.mat_(2 * k + 1, j) = piParamStat_.getStatStorage()(k, j);
+			}
+		}
+
+		outG_.add_payload( { "variable", "param", idName_ }, "stat", paramStatOut);
+		outG_.add_payload( { "variable", "param", idName_ }, "paramStr", paramStr_);
+
+		if (os.paramLog_) {
+			Index nLog = muParamStat_.getLogStorage().cols();
+			NamedMatrix<Real> paramLogOut(2 * nClass_, nLog, false);
+			paramLogOut.rowNames_ = paramNames();
+			for (Index k = 0; k < nClass_; ++k) {
+				for (Index j = 0; j < nLog; ++j) {
+					paramLogOut.mat_(2 * k, j) = muParamStat_.getLogStorage()(k, j) + minModality;
+					paramLogOut.mat_(2 * k + 1, j) = piParamStat_.getLogStorage()(k, j);
+				}
+			}
+			outG_.add_payload( { "variable", "param", idName_ }, "log", paramLogOut);
+		}
+	}
+
+	/**
+	 * The paths are sampled exactly from their conditional distribution, using parameters common to all the classes, so that the
+	 * initialization does not depend on the data of the other individuals.
+	 */
+	void initData(Index i) {
+		path_(i).samplePath(initTable_);
+		augData_.data_(i) = path_(i).x();
+	}
+
+	void initParam() {
+		for (Index k = 0; k < nClass_; ++k) {
+			mu_(k) = initTable_.mu();
+			pi_(k) = piInitBOS;
+		}
+		computeTable();
+	}
+
+	/**
+	 * The paths are sampled exactly by samplePath, there is no Markov chain to initialize.
+	 */
+	void initializeMarkovChain(Index i, Index k) {
+	}
+
+	/**
+	 * The observed probabilities are read from the tables, which are already up to date with the parameters.
+	 */
+	void computeObservedProba() {
+		computeTable();
+	}
+
+	bool sampleApproximationOfObservedProba() {
+		return false;
+	}
+
+private:
+	/**
+	 * Use information in AugmentedData to set the values of every path in path_. Called at the end of setDataParam
+	 * */
+	void setPath() {
+		path_.resize(nInd_);
+
+		for (Index i = 0; i < nInd_; ++i) {
+			path_(i).setInit(0, nbModality_ - 1); // every initial segment is the same and spans all the modalities
+			if (augData_.misData_(i).first == present_) { // final value is set
+				path_(i).setEnd(augData_.data_(i), augData_.data_(i));
+			} else if (augData_.misData_(i).first == missing_) {
+				path_(i).setEnd(0, nbModality_ - 1); // final interval is the same as initial interval
+			} else if (augData_.misData_(i).first == missingIntervals_) {
+				path_(i).setEnd(augData_.misData_(i).second[0], augData_.misData_(i).second[1]); // bounds of the interval are provided
+			}
+		}
+	}
+
+	void computeTable() {
+		for (Index k = 0; k < nClass_; ++k) {
+			table_[k].compute(nbModality_, mu_(k), pi_(k));
+		}
+	}
+
+	/**
+	 * The completed probability of a path is null for the modes outside of [BOSPath::muMin, BOSPath::muMax], and since the paths are sampled
+	 * conditionally to the current mode, this intersection over a class quickly reduces to the current mode, which would then never move.
+	 * mu is instead sampled from its distribution conditional to the observed data, using a table for each candidate mode and the current pi.
+	 * When mu moves, mStep samples the paths of the class again with the new mode, so that every individual keeps a non null completed
+	 * probability in its class.
+	 */
+	void mStepMu(const std::set<Index>& classInd, Index k) {
+		Vector<Real> logLik(nbModality_, 0.);
+		for (int mu = 0; mu < nbModality_; ++mu) {
+			muTable_.compute(nbModality_, mu, pi_(k));
+			for (std::set<Index>::const_iterator it = classInd.begin(), itEnd = classInd.end(); it != itEnd; ++it) {
+				logLik(mu) += lnObservedProbability(*it, muTable_);
+			}
+		}
+
+		Vector<Real> proba;
+		proba.logToMulti(logLik);
+		mu_(k) = multi_.sample(proba);
+	}
+
+	/**
+	 * Estimation of pi by maximum likelihood in a particular class. pi = 1 is excluded: every observation but the mode would have a null
+	 * probability in the class, and since the paths sampled with pi = 1 only contain z = 1, pi would never move again.
+	 * */
+	void mStepPi(const std::set<Index>& classInd, Index k) {
+		Real nodePerClass = 0.; // total number of nodes in class k
+		Real zPerClass = 0.; // total of nodes with z = 1 in class k
+
+		for (std::set<Index>::const_iterator it = classInd.begin(), itEnd = classInd.end(); it != itEnd; ++it) {
+			zPerClass += path_(*it).nbZ(); // add only z = 1 nodes of the individual
+			nodePerClass += path_(*it).nbNode(); // add all nodes of the individual
+		}
+
+		pi_(k) = std::min(zPerClass / nodePerClass, 1. - epsilon); // from accounts to frequencies of z -> maximum likelihood estimate of pi
+	}
+
+	Real lnObservedProbability(Index i, const BOSTable& table) const {
+		if (augData_.misData_(i).first == present_) {
+			return table.lnObservedProbability(augData_.data_(i), augData_.data_(i));
+		} else if (augData_.misData_(i).first == missingIntervals_) {
+			return table.lnObservedProbability(augData_.misData_(i).second[0], augData_.misData_(i).second[1]);
+		}
+
+		return 0.; // missing_, marginalized over all modalities
+	}
+
+	std::vector<std::string> paramNames() const {
+		std::vector<std::string> names(nClass_ * 2);
+		for (Index k = 0; k < nClass_; ++k) {
+			names[2 * k] = "k: " + std::to_string(k + minModality) + ", mu";
+			names[2 * k + 1] = "k: " + std::to_string(k + minModality) + ", pi";
+		}
+		return names;
+	}
+
+	/** Number of modalities */
+	int nbModality_;
+
+	/** Confidence level used in computation of parameters and missing values statistics */
+	Real confidenceLevel_;
+
+	const Graph& dataG_;
+	const Graph& paramG_;
+	Graph& outG_;
+
+	/** The augmented data set */
+	AugmentedData<Vector<int> > augData_;
+
+	/** Vector containing path for individuals */
+	Vector<BOSPath> path_;
+
+	/** Mode parameter, one element per class */
+	Vector<int> mu_;
+
+	/** Precision parameter, one element per class */
+	Vector<Real> pi_;
+
+	/** Probabilities of the model for the current parameters, one element per class */
+	std::vector<BOSTable> table_;
+
+	/** Probabilities of the model for the parameters used in initData */
+	BOSTable initTable_;
+
+	/** Probabilities of the model for each candidate mode in mStepMu */
+	BOSTable muTable_;
+
+	/** Sampler used in the estimation of mu */
+	MultinomialStatistic multi_;
+
+	/** Compute the statistics on missing data during GibbsRun phase */
+	ConfIntDataStat<int> dataStat_;
+
+	/** Compute the statistics on mu parameter */
+	ConfIntParamStat<Vector<int> > muParamStat_;
+
+	/** Compute the statistics on pi parameter */
+	ConfIntParamStat<Vector<Real> > piParamStat_;
+
+	Vector<bool> acceptedType_;
+
+	std::string paramStr_;
+};
+
+} // namespace mixt
+
+#endif // LIB_MIXTURE_ORDINAL_ORDINALMIXTURE_H
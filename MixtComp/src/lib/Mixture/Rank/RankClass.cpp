@@ -24,7 +24,7 @@
 
 namespace mixt {
 RankClass::RankClass(const Vector<RankIndividual>& data, RankVal& mu, Real& pi) :
-		nbInd_(data.size()), data_(data), mu_(mu), pi_(pi) {
+		nbInd_(data.size()), data_(data), mu_(mu), pi_(pi), isObservedProbaExact_(true) {
 }
 
 Real RankClass::lnCompletedProbability(const std::set<Index>& setInd) const {
@@ -75,19 +75,11 @@ Real RankClass::lnObservedProbability(int i) const {
 		std::cout << "RankClass::lnObservedProbability, enumCompleted" << std::endl;
 #endif
 
-		std::list<RankVal> allCompleted = data_(i).enumCompleted(); // get the list of all possible completions of observation i
+		const std::vector<Index>& allCompleted = data_(i).completed(); // all possible completions of observation i, enumerated once
 		Vector<Real> allCompletedProba(allCompleted.size()); // used to "linearize" the storage of probabilities from allCompleted
 
-		int c = 0;
-		for (std::list<RankVal>::const_iterator it = allCompleted.begin(), itE =
-				allCompleted.end(); it != itE; ++c, ++it) {
-			std::map<RankVal, Real>::const_iterator itM =
-					observedProbaSampling_.find(*it); // has the current completion been observed in computeObservedProba ?
-			if (itM == observedProbaSampling_.end()) { // the current individual has not been observed during sampling
-				allCompletedProba(c) = minInf;
-			} else {
-				allCompletedProba(c) = std::log(itM->second);
-			}
+		for (Index c = 0; c < allCompleted.size(); ++c) {
+			allCompletedProba(c) = observedProba_.at(allCompleted[c]); // computed in computeObservedProba
 		}
 
 #ifdef MC_DEBUG
@@ -106,10 +98,14 @@ void RankClass::sampleMu(const std::set<Index>& setInd) {
 	Vector<Real, 2> proba; // multinomial distribution obtained from the logProba
 
 	logProba(0) = lnCompletedProbability(setInd); // proba of current mu
+	Real logRatio = std::log(pi_) - std::log(1. - pi_); // variation of the log proba of an individual when its g increases by one
 
 	for (int p = 0; p < mu_.nbPos() - 1; ++p) {
-		mu_.permutation(p);
-		logProba(1) = lnCompletedProbability(setInd);
+		int dG = 0; // a permutation only changes the comparisons between the two permuted modalities, hence the log proba is updated incrementally
+		for (std::set<Index>::const_iterator it = setInd.begin(), itEnd = setInd.end(); it != itEnd; ++it) {
+			dG += data_(*it).deltaG(mu_, p);
+		}
+		logProba(1) = (dG == 0) ? logProba(0) : logProba(0) + dG * logRatio;
 		proba.logToMulti(logProba);
 
 #ifdef MC_DEBUG
@@ -117,9 +113,8 @@ void RankClass::sampleMu(const std::set<Index>& setInd) {
 #endif
 
 		if (multi_.sample(proba) == 1) { // switch to permuted state ?
+			mu_.permutation(p);
 			logProba(0) = logProba(1); // accept permutation
-		} else {
-			mu_.permutation(p); // revert to previous state
 		}
 	}
 }
@@ -150,11 +145,48 @@ void RankClass::mStep(const std::set<Index>& setInd) {
 }
 
 void RankClass::computeObservedProba() {
-	RankIndividual ri(mu_.nbPos()); // dummy rank individual used to compute a Vector<std::map<RankVal, Real> > for each class
-	Vector<MisVal> obsData(mu_.nbPos(), MisVal(missing_, { })); // individual is completely missing, so that remove missing will reinitialize everything upon call
+	RankIndividual ri(mu_.nbPos());
+	computeObservedProba(ri);
+}
+
+void RankClass::computeObservedProba(RankIndividual& ri) {
+	Vector<MisVal> obsData(mu_.nbPos(), MisVal(missing_, { }));
 	ri.setObsData(obsData);
 	ri.removeMissing();
-	ri.observedProba(mu_, pi_, observedProbaSampling_);
+
+	observedProba_.clear();
+	std::vector<Index> allCode; // distinct completions of all the individuals
+	for (int i = 0; i < data_.size(); ++i) {
+		if (data_(i).allMissing()) {
+			continue;
+		}
+
+		const std::vector<Index>& allCompleted = data_(i).completed();
+		for (std::vector<Index>::const_iterator it = allCompleted.begin(), itE = allCompleted.end(); it != itE; ++it) {
+			if (observedProba_.emplace(*it, 0.).second) { // completion not shared with a previous individual
+				allCode.push_back(*it);
+			}
+		}
+	}
+
+	isObservedProbaExact_ = isExactObservedProbaCheaper(mu_.nbPos(), allCode.size());
+	for (std::vector<Index>::const_iterator it = allCode.begin(), itE = allCode.end(); it != itE; ++it) {
+		ri.xModif().setCode(*it);
+		if (isObservedProbaExact_) {
+			observedProba_[*it] = ri.lnMarginalProbability(mu_, pi_);
+		} else {
+			observedProba_[*it] = ri.lnMarginalProbability(mu_, pi_, relErrorObservedRank, nbSampleObserved);
+		}
+	}
+}
+
+bool RankClass::isExactObservedProbaCheaper(int nbPos, Index nbCompletion) {
+	if (maxNbPosExactRank < nbPos) {
+		return false;
+	}
+
+	Index nbSet = Index(1) << nbPos; // the exact computation of a completion costs nbSet * nbPos insertions
+	return nbSet <= Index(nbSampleMinObserved * nbPos) || nbCompletion * nbSet <= Index(nbSampleObserved * nbPos);
 }
 
 } // namespace mixt
@@ -27,6 +27,7 @@
 #include <Mixture/Rank/RankIndividual.h>
 #include <Mixture/Rank/RankVal.h>
 #include <set>
+#include <unordered_map>
 
 
 namespace mixt {
@@ -55,7 +56,27 @@ public:
 	/** */
 	void mStep(const std::set<Index>& setInd);
 
+	/** Compute the log-probabilities of all the completions of the individuals which are not completely missing. Each
+	 * completion is computed once, even if it is shared by several individuals. */
 	void computeObservedProba();
+
+	/** Same as computeObservedProba(), ri is used to compute the probabilities of the completions and its random number generator
+	 * is used if they are estimated. It is provided by the caller so that it can be created outside of a parallel region, where its
+	 * seed would depend on the scheduling of the threads. */
+	void computeObservedProba(RankIndividual& ri);
+
+	/** Are the log-probabilities of the completions computed exactly in the last call to computeObservedProba ? */
+	bool isObservedProbaExact() const {
+		return isObservedProbaExact_;
+	}
+
+	/**
+	 * The exact computation of a completion costs 2^nbPos * nbPos insertions, and the estimation by importance sampling at least
+	 * nbSampleMinObserved * nbPos^2. The exact computation is used when it is cheaper than this minimum, or when its total cost
+	 * for the nbCompletion distinct completions is lower than the nbSampleObserved * nbPos^2 insertions used to sample the
+	 * observed distribution of a class.
+	 */
+	static bool isExactObservedProbaCheaper(int nbPos, Index nbCompletion);
 private:
 	int nbInd_;
 
@@ -70,9 +91,11 @@ private:
 
 	MultinomialStatistic multi_;
 
-	/** Vector of map containing observed probability distribution, used in independent sampling estimation.
-	 * Each element of the vector corresponds to a class */
-	std::map<RankVal, Real> observedProbaSampling_;
+	/** Log-probabilities of the completions of the observed individuals, identified by their RankVal::code. They are
+	 * computed exactly when it is cheaper, see isExactObservedProbaCheaper, and estimated with a relative error otherwise. */
+	std::unordered_map<Index, Real> observedProba_;
+
+	bool isObservedProbaExact_;
 };
 
 } // namespace mixt
@@ -22,8 +22,7 @@
 
 #include <LinAlg/Maths.h>
 #include <Mixture/Rank/RankIndividual.h>
-#include<set>
-
+#include <bitset>
 
 namespace mixt {
 
@@ -48,7 +47,7 @@ RankIndividual::RankIndividual(const RankVal& rv) :
 RankIndividual::RankIndividual(const RankIndividual& ri) :
 		nbPos_(ri.nbPos_), lnFacNbPos_(ri.lnFacNbPos_), obsData_(ri.obsData_), x_(
 				ri.x_), y_(ri.y_), allPresent_(ri.allPresent_), allMissing_(
-				ri.allMissing_) {
+				ri.allMissing_), completed_(ri.completed_) {
 } // note that the state of multi_ is not copied and a new rng is created
 
 RankIndividual& RankIndividual::operator=(const RankIndividual& ri) {
@@ -57,6 +56,7 @@ RankIndividual& RankIndividual::operator=(const RankIndividual& ri) {
 	obsData_ = ri.obsData_;
 	x_ = ri.x_;
 	y_ = ri.y_;
+	completed_ = ri.completed_;
 
 	return *this;
 } // note that the state of multi_ is not copied and a new rng is created
@@ -85,13 +85,10 @@ void RankIndividual::removeMissing() {
 		std::iota(xVec.begin(), xVec.end(), 0);
 		x_.setO(xVec);
 	} else { // uniform sampling on all the possible completions
-		std::list<RankVal> rankList = enumCompleted();
-
-		int sampledIndex = multi_.sampleInt(0, rankList.size() - 1);
-		std::list<RankVal>::const_iterator it = rankList.begin();
-		std::advance(it, sampledIndex);
+		const std::vector<Index>& codes = completed();
 
-		x_ = *it;
+		int sampledIndex = multi_.sampleInt(0, codes.size() - 1);
+		x_.setCode(codes[sampledIndex]);
 	}
 }
 
@@ -114,8 +111,9 @@ Real RankIndividual::xGen(const RankVal& mu, Real pi) {
 	Real goodlp = std::log(pi);
 	Real badlp = std::log(1. - pi);
 
-	std::vector<int> x(1); // vector is suboptimal for insertion, but provides contiguous memory storage which will fit in CPU cache. std::list on the contrary does not guarantee contiguity.
+	std::vector<int>& x = xGenBuffer_; // vector is suboptimal for insertion, but provides contiguous memory storage which will fit in CPU cache. Its capacity is kept between calls to avoid allocations.
 	x.reserve(nbPos_);
+	x.resize(1);
 
 	x[0] = y_(0);
 
@@ -183,35 +181,188 @@ void RankIndividual::AG(const RankVal& mu, int& a, int& g) const {
 	a = 0;
 	g = 0;
 
-	std::vector<int> x(1); // vector is suboptimal for insertion, but provides contiguous memory storage which will fit in CPU cache
-	x.reserve(nbPos_);
+	if (nbPos_ == 0) {
+		return;
+	}
 
-	x[0] = y_(0);
+	// The partially sorted vector of the insertion sort always contains the elements already presented, in the order of x_. The
+	// elements are therefore identified by their positions in x_, and the set of elements already presented by a bit mask
+	// over those positions, which fits in an Index since nbPos_ <= maxNbPosRank.
+	Index muLess[sizeof(Index) * 8];
+	muLessMask(mu, muLess);
 
-	for (int j = 1; j < nbPos_; ++j) // current element in the presentation order, or current size of the x vector
-			{
+	Index placed = Index(1) << x_.r()(y_(0));
+
+	for (int j = 1; j < nbPos_; ++j) {
 		int currY = y_(j);
-		bool yPlaced = false; // y not considered at correct position until proven so
+		int currA, currG;
+		insertionAG(placed, currY, mu, muLess, currA, currG);
+		a += currA;
+		g += currG;
 
-		for (int i = 0; i < j; ++i) {
-			yPlaced = (x_.r()(currY) < x_.r()(x[i]));
+		placed |= Index(1) << x_.r()(currY);
+	}
+}
 
-			if (yPlaced == (mu.r()(currY) < mu.r()(x[i]))) { // is the comparison correct, according to the order provided in mu ?
-				++a;
-				++g;
-			} else {
-				++a;
+void RankIndividual::muLessMask(const RankVal& mu, Index* muLess) const {
+	Index muMask = 0;
+	for (int p = 0; p < nbPos_; ++p) {
+		int currMod = mu.o()(p);
+		muLess[currMod] = muMask;
+		muMask |= Index(1) << x_.r()(currMod);
+	}
+}
+
+void RankIndividual::insertionAG(Index placed, int currY, const RankVal& mu, const Index* muLess, int& a, int& g) const {
+	int currPos = x_.r()(currY);
+	Index before = placed & ((Index(1) << currPos) - 1); // elements compared to currY without finding its position
+	Index after = placed & ~((Index(2) << currPos) - 1);
+
+	a = std::bitset<sizeof(Index) * 8>(before).count();
+	g = std::bitset<sizeof(Index) * 8>(before & muLess[currY]).count(); // comparisons which are correct according to mu
+
+	if (after != 0) { // currY is placed before the first element that follows it in x_, and this comparison is counted too
+		Index firstAfter = after & (~after + 1);
+		int firstAfterMod = x_.o()(std::bitset<sizeof(Index) * 8>(firstAfter - 1).count());
+		++a;
+		if (mu.r()(currY) < mu.r()(firstAfterMod)) {
+			++g;
+		}
+	}
+}
+
+Real RankIndividual::lnMarginalProbability(const RankVal& mu, Real pi) const {
+	Index muLess[sizeof(Index) * 8];
+	muLessMask(mu, muLess);
+
+	Real lnPi = std::log(pi);
+	Real ln1mPi = std::log(1. - pi);
+
+	// The comparisons performed when inserting an element only depend on the set of elements already presented, and not on
+	// their order. The sum over all presentation orders is therefore computed by summing over the sets of presented elements,
+	// identified by bit masks over the positions in x_.
+	Index nbSet = Index(1) << nbPos_;
+	std::vector<Real> sumSet(nbSet, 0.);
+	for (int m = 0; m < nbPos_; ++m) {
+		sumSet[Index(1) << x_.r()(m)] = 1.;
+	}
+
+	for (Index placed = 1; placed < nbSet; ++placed) {
+		if (sumSet[placed] == 0.) {
+			continue;
+		}
+
+		for (int m = 0; m < nbPos_; ++m) {
+			Index currBit = Index(1) << x_.r()(m);
+			if ((placed & currBit) == 0) {
+				int a, g;
+				insertionAG(placed, m, mu, muLess, a, g);
+				sumSet[placed | currBit] += sumSet[placed] * std::exp(g * lnPi + (a - g) * ln1mPi);
 			}
+		}
+	}
 
-			if (yPlaced) {
-				x.insert(x.begin() + i, currY);
-				break;
+	return lnFacNbPos_ + std::log(sumSet[nbSet - 1]);
+}
+
+Real RankIndividual::lnMarginalProbability(const RankVal& mu, Real pi, Real relError, int nbSampleMax) {
+	Index muLess[sizeof(Index) * 8];
+	muLessMask(mu, muLess);
+
+	Real lnPi = std::log(pi);
+	Real ln1mPi = std::log(1. - pi);
+
+	Vector<Real> proposal(nbPos_); // probability of presenting each modality next, given the elements already presented
+
+	Real logRef = 0.; // weights are accumulated relatively to logRef, to avoid underflow
+	Real sumW = 0.;
+	Real sumW2 = 0.;
+
+	int n = 0;
+	while (n < nbSampleMax) {
+		// Sequential importance sampling: each element is presented with a probability proportional to the probability of its
+		// insertion. The weight of the sampled presentation order is the product of the normalizing constants.
+		int first = multi_.sampleInt(0, nbPos_ - 1);
+		Index placed = Index(1) << x_.r()(first);
+		Real logW = lnFacNbPos_ + std::log(Real(nbPos_));
+
+		for (int j = 1; j < nbPos_; ++j) {
+			Real sumProposal = 0.;
+			int lastCandidate = 0;
+			for (int m = 0; m < nbPos_; ++m) {
+				if ((placed & (Index(1) << x_.r()(m))) == 0) {
+					int a, g;
+					insertionAG(placed, m, mu, muLess, a, g);
+					proposal(m) = std::exp(g * lnPi + (a - g) * ln1mPi);
+					sumProposal += proposal(m);
+					lastCandidate = m;
+				} else {
+					proposal(m) = 0.;
+				}
+			}
+
+			proposal /= sumProposal;
+			int currY = multi_.sample(proposal);
+			if (currY == -1) { // rounding error in the normalization
+				currY = lastCandidate;
 			}
+
+			logW += std::log(sumProposal);
+			placed |= Index(1) << x_.r()(currY);
 		}
-		if (!yPlaced) {
-			x.push_back(currY); // if element j has not been placed yet, it goes at the end of x
+
+		if (n == 0) {
+			logRef = logW;
+		} else if (logRef < logW) {
+			Real scale = std::exp(logRef - logW);
+			sumW *= scale;
+			sumW2 *= scale * scale;
+			logRef = logW;
+		}
+
+		Real w = std::exp(logW - logRef);
+		sumW += w;
+		sumW2 += w * w;
+		++n;
+
+		if (nbSampleMinObserved <= n && (sumW2 / sumW - sumW / n) / sumW <= relError * relError) { // squared relative standard error of the mean
+			break;
+		}
+	}
+
+	return logRef + std::log(sumW / n);
+}
+
+int RankIndividual::deltaG(const RankVal& mu, int pos) const {
+	int m0 = mu.o()(pos);
+	int m1 = mu.o()(pos + 1);
+
+	int j = 0;
+	while (y_(j) != m0 && y_(j) != m1) {
+		++j;
+	}
+	int e = y_(j); // the first presented of the two modalities
+	int c = (e == m0) ? m1 : m0; // the modality inserted later, which might be compared to e
+	int xE = x_.r()(e);
+	int xC = x_.r()(c);
+
+	bool compared = true;
+	if (xC < xE) { // c is compared to e only if e is the first element after c in x_ among those presented before c
+		for (j = 0; y_(j) != c; ++j) {
+			int xCurr = x_.r()(y_(j));
+			if (xC < xCurr && xCurr < xE) {
+				compared = false;
+				break;
+			}
 		}
 	}
+
+	if (!compared) {
+		return 0;
+	}
+
+	bool correct = (xC < xE) == (mu.r()(c) < mu.r()(e));
+	return correct ? -1 : 1;
 }
 
 void RankIndividual::sampleX(const RankVal& mu, Real pi) {
@@ -236,27 +387,41 @@ void RankIndividual::sampleX(const RankVal& mu, Real pi) {
 	}
 }
 
-/**
- * Perform one round of Gibbs sampling for the presentation order
- * @param mu central rank
- * @param pi precision */
 void RankIndividual::sampleY(const RankVal& mu, Real pi) {
-	int A, G; // dummy variables
-	Vector<Real, 2> logProba; // first element: current log proba, second element: logProba of permuted state
+	Vector<Real, 2> logProba; // first element: current log proba, second element: logProba of permuted state, both relative to the current state
 	Vector<Real, 2> proba; // multinomial distribution obtained from the logProba
 
-	logProba(0) = lnCompletedProbability(mu, pi, A, G); // proba of current y
+	Index muLess[sizeof(Index) * 8];
+	muLessMask(mu, muLess);
+
+	Real lnPi = std::log(pi);
+	Real ln1mPi = std::log(1. - pi);
+
+	logProba(0) = 0.;
+	Index placed = 0; // elements presented before position p
 
 	for (int p = 0; p < nbPos_ - 1; ++p) {
-		permutationY(p);
-		logProba(1) = lnCompletedProbability(mu, pi, A, G);
+		int first = y_(p);
+		int second = y_(p + 1);
+		Index firstBit = Index(1) << x_.r()(first);
+		Index secondBit = Index(1) << x_.r()(second);
+
+		int a0, g0, a1, g1, aPerm0, gPerm0, aPerm1, gPerm1;
+		insertionAG(placed, first, mu, muLess, a0, g0);
+		insertionAG(placed | firstBit, second, mu, muLess, a1, g1);
+		insertionAG(placed, second, mu, muLess, aPerm0, gPerm0);
+		insertionAG(placed | secondBit, first, mu, muLess, aPerm1, gPerm1);
+
+		int dA = aPerm0 + aPerm1 - a0 - a1;
+		int dG = gPerm0 + gPerm1 - g0 - g1;
+		logProba(1) = dG * lnPi + (dA - dG) * ln1mPi;
 
 		proba.logToMulti(logProba);
 		if (multi_.sample(proba) == 1) { // switch to permuted state ?
-			logProba(0) = logProba(1); // accept permutation
-		} else {
-			permutationY(p); // revert to previous state
+			permutationY(p);
 		}
+
+		placed |= Index(1) << x_.r()(y_(p));
 	}
 }
 
@@ -269,70 +434,19 @@ void RankIndividual::permutationY(int firstElem) {
 void RankIndividual::probaYgX(const RankVal& mu, Real pi,
 		Vector<Vector<int> >& resVec, Vector<Real>& resProba) {
 	int nbInd = fac(nbPos_);
-
-	std::set<int> remainingMod;
-	for (int m = 0; m < nbPos_; ++m) {
-		remainingMod.insert(m);
-	}
-
-	Vector<int> vec(nbPos_);
-	Vector<Real> logProba(nbInd);
-
-	recYgX(mu, pi, resVec, logProba, vec, remainingMod, 0, nbInd, 0, nbPos_);
-
-	resProba.logToMulti(logProba); // from log of joint distribution to conditional distribution
-}
-
-void RankIndividual::recYgX(const RankVal& mu, Real pi,
-		Vector<Vector<int> >& resVec, Vector<Real>& resProba, Vector<int>& vec,
-		const std::set<int>& remainingMod, int firstElem, int nbElem,
-		int currPos, int nbPos) {
 	int a, g; // dummy variables
-	if (currPos == nbPos) { // no more modalities to add in the vector
-		y_ = vec; // assignment to compute
-		resVec(firstElem) = vec;
-		resProba(firstElem) = lnCompletedProbability(mu, pi, a, g); // register current vector and its value
-	} else {
-		int nextNbElem = nbElem / (nbPos - currPos);
-		int indexMod = 0;
-		for (std::set<int>::const_iterator it = remainingMod.begin();
-				it != remainingMod.end(); ++it, ++indexMod) // iteration over the modality that have not yet been included in the vector
-				{
-			std::set<int> remainingModNew = remainingMod; // computation of the modalities available for the remaining of vec
-			for (std::set<int>::iterator itNew = remainingModNew.begin();
-					itNew != remainingModNew.end(); ++itNew) {
-				if (*itNew == *it) // the current modality will not be available further down the vector
-						{
-					remainingModNew.erase(itNew);
-					break;
-				}
-			}
-
-			vec(currPos) = *it;
-			recYgX(mu, pi, resVec, resProba, vec, remainingModNew,
-					firstElem + indexMod * nextNbElem, nextNbElem, currPos + 1,
-					nbPos);
-		}
-	}
-}
 
-void RankIndividual::observedProba(const RankVal& mu, Real pi,
-		std::map<RankVal, Real>& proba) {
-	proba.clear();
-	for (int i = 0; i < nbSampleObserved; ++i) {
-		yGen();
-		xGen(mu, pi);
-		proba[x_] += 1.;
+	RankVal y(nbPos_);
+	Vector<Real> logProba(nbInd);
 
-#ifdef MC_DEBUG
-		std::cout << "RankIndividual::observedProba, i: " << i << ", x_: " << x_ << std::endl;
-#endif
+	for (int c = 0; c < nbInd; ++c) {
+		y.setCode(c);
+		y_ = y.o();
+		resVec(c) = y_;
+		logProba(c) = lnCompletedProbability(mu, pi, a, g);
 	}
 
-	for (std::map<RankVal, Real>::iterator it = proba.begin(), itEnd =
-			proba.end(); it != itEnd; ++it) {
-		it->second /= Real(nbSampleObserved);
-	}
+	resProba.logToMulti(logProba); // from log of joint distribution to conditional distribution
 }
 
 bool RankIndividual::checkMissingType(const Vector<bool>& acceptedType) const {
@@ -345,99 +459,54 @@ bool RankIndividual::checkMissingType(const Vector<bool>& acceptedType) const {
 	return true;
 }
 
-std::list<int> RankIndividual::candidateList(int currPos,
-		const std::set<int>& remainingMod) const {
-	std::list<int> candidateList;
-
-	if (obsData_(currPos).first == present_) { // if data is present
-		if (remainingMod.find(x_.o()(currPos)) != remainingMod.end()) { // only add the observed value if it is still available, to avoid duplication of value in completed individual
-#ifdef MC_DEBUG
-				std::cout << "RankIndividual::candidateList, present_, x_.o(): " << itString(x_.o()) << std::endl;
-#endif
-
-			candidateList.push_back(x_.o()(currPos));
-		}
-	} else if (obsData_(currPos).first == missing_) { // since value is unobserved, all candidates can be considered
-		for (std::set<int>::const_iterator it = remainingMod.begin(), itE =
-				remainingMod.end(); it != itE; ++it) {
-			candidateList.push_back(*it);
-		}
-	} else if (obsData_(currPos).first == missingFiniteValues_) { // only add the intersection between what is possible and what is available
-#ifdef MC_DEBUG
-			std::cout << "RankIndividual::candidateList, missingFiniteValues_, obsData_(currPos).second: " << itString(obsData_(currPos).second) << std::endl;
-#endif
+std::list<RankVal> RankIndividual::enumCompleted() const {
+	std::list<RankVal> rankList;
+	RankVal rv(nbPos_);
 
-		std::set_intersection(
-				remainingMod.begin(), // compute the intersection between the remainingMod and the currently possible missing value
-				remainingMod.end(), obsData_(currPos).second.begin(),
-				obsData_(currPos).second.end(),
-				std::back_inserter(candidateList));
+	const std::vector<Index>& codes = completed();
+	for (std::vector<Index>::const_iterator it = codes.begin(), itE = codes.end(); it != itE; ++it) {
+		rv.setCode(*it);
+		rankList.push_back(rv);
 	}
 
-	return candidateList;
+	return rankList;
 }
 
-std::list<RankVal> RankIndividual::recEnumComplete(int currPos,
-		const std::set<int>& remainingMod,
-		const Vector<int>& completedVec) const {
-#ifdef MC_DEBUG
-	std::cout << "RankIndividual::recEnumComplete, currPos: " << currPos << ", "
-	<< "remainingMod: " << itString(remainingMod) << ", "
-	<< "completedVec: " << itString(completedVec) << std::endl;
-#endif
-
-	std::list<RankVal> rankList;
-
-	if (currPos != nbPos_) { // recursive calls remain
-		std::list<int> cl = candidateList(currPos, // compute the list of possible modalities for the current position, considering the observation
-				remainingMod);
-
-#ifdef MC_DEBUG
-		std::cout << "cl.size(): " << cl.size() << std::endl;
-#endif
-
-		for (std::list<int>::const_iterator it = cl.begin(), itE = cl.end();
-				it != itE; ++it) {
-#ifdef MC_DEBUG
-			std::cout << "cl, *it: " << *it << std::endl;
-#endif
-
-			std::set<int> subRemainingMod = remainingMod;
-			subRemainingMod.erase(*it);
-			Vector<int> subCompletedVec = completedVec;
-			subCompletedVec(currPos) = *it;
-
-			rankList.merge(
-					recEnumComplete(currPos + 1, subRemainingMod,
-							subCompletedVec));
+const std::vector<Index>& RankIndividual::completed() const {
+	if (!completed_) {
+		Vector<Index> authorizedMod(nbPos_, 0); // the candidates at each position, given the observation
+		for (int p = 0; p < nbPos_; ++p) {
+			for (int m = 0; m < nbPos_; ++m) {
+				if ((obsData_(p).first == present_ && x_.o()(p) == m) || isAuthorized(m, obsData_(p))) {
+					authorizedMod(p) |= Index(1) << m;
+				}
+			}
 		}
-	} else { // termination condition of the recursion
-#ifdef MC_DEBUG
-	std::cout << "RankIndividual::recEnumComplete, termination" << std::endl;
-#endif
 
-		RankVal rv(nbPos_);
-		rv.setO(completedVec);
-		rankList.push_back(rv);
+		std::shared_ptr<std::vector<Index> > codes = std::make_shared<std::vector<Index> >();
+		recEnumCompleted(0, (Index(1) << nbPos_) - 1, 0, authorizedMod, *codes);
+		completed_ = codes;
 	}
 
-	return rankList;
+	return *completed_;
 }
 
-std::list<RankVal> RankIndividual::enumCompleted() const {
-	std::list<RankVal> rankList;
-	std::set<int> remainingMod;
-	Vector<int> completedVec(nbPos_, -1);
-
-	for (int i = 0; i < nbPos_; ++i) {
-		remainingMod.insert(i);
+void RankIndividual::recEnumCompleted(int currPos, Index remainingMod, Index code,
+		const Vector<Index>& authorizedMod,
+		std::vector<Index>& completed) const {
+	if (currPos == nbPos_) { // termination condition of the recursion
+		completed.push_back(code);
+		return;
 	}
 
-	rankList = recEnumComplete(0, // currPos
-			remainingMod, // remaining mod
-			completedVec); // completedVec
-
-	return rankList;
+	Index candidate = remainingMod & authorizedMod(currPos);
+	for (int m = 0; m < nbPos_; ++m) { // modalities are tried in increasing order, so that codes are generated in increasing order
+		Index bit = Index(1) << m;
+		if (candidate & bit) {
+			Index digit = std::bitset<64>(remainingMod & (bit - 1)).count(); // number of smaller modalities still available, see RankVal::code
+			recEnumCompleted(currPos + 1, remainingMod & ~bit, code * (nbPos_ - currPos) + digit, authorizedMod, completed);
+		}
+	}
 }
 
 /** Is a value authorized for a particular MisVal ? */
@@ -479,6 +548,7 @@ bool RankIndividual::checkPermutation(int pos) const {
 
 void RankIndividual::setObsData(const Vector<MisVal>& v) {
 	obsData_ = v;
+	completed_.reset();
 
 	for (int p = 0; p < nbPos_; ++p) {
 		if (obsData_(p).first != missing_) {
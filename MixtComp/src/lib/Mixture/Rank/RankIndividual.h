@@ -26,7 +26,9 @@
 #include <Mixture/Rank/RankVal.h>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "../../LinAlg/LinAlg.h"
 #include "../../Various/Enum.h"
@@ -99,7 +101,9 @@ public:
 	void sampleX(const RankVal& mu, Real pi);
 
 	/**
-	 * Perform one round of Gibbs sampling for the presentation order
+	 * Perform one round of Gibbs sampling for the presentation order. Permuting two consecutive elements of the presentation
+	 * order only changes their own insertions, as the sets of elements presented before the following ones are unchanged,
+	 * so each permutation is evaluated in constant time and without allocation.
 	 * @param mu central rank
 	 * @param pi precision */
 	void sampleY(const RankVal& mu, Real pi);
@@ -127,40 +131,38 @@ public:
 
 	void AG(const RankVal& mu, int& a, int& g) const;
 
-	void probaYgX(const RankVal& mu, Real pi, Vector<Vector<int> >& resVec,
-			Vector<Real>& resProba);
+	/**
+	 * Variation of g if the modalities at positions pos and pos + 1 of mu were permuted. Only the comparison between those two
+	 * modalities changes, if it occurs in the insertion sort, so a is unchanged and g varies by at most one.
+	 * @param mu central rank, before the permutation
+	 * @param pos position of the first permuted modality in mu
+	 * @return -1, 0 or 1 */
+	int deltaG(const RankVal& mu, int pos) const;
 
 	/** Compute the probability distribution of Y given X, to check the Gibbs sampling of Y given X.
-	 * The Y are stored in resVec, the associated probabilities in resProba. The function is recursive
-	 * to easily cover all possible cases and modifies the tail of the argument vec. */
-	void recYgX(const RankVal& mu, Real pi, Vector<Vector<int> >& resVec,
-			Vector<Real>& resProba, Vector<int>& vec,
-			const std::set<int>& remainingMod, int firstElem, int nbElem,
-			int currPos, int nbPos);
-
-	/** Compute the observed probability distribution for mu and pi, by generating nbSampleObserved
-	 * independent observations and marginalizing over presentation order. This procedure is similar
-	 * to what is used in the Ordinal model, and in contrast with the use of the harmonic mean estimator
-	 * of the observed probability. */
-	void observedProba(const RankVal& mu, Real pi,
-			std::map<RankVal, Real>& proba);
+	 * The Y are stored in resVec, in lexicographic order, as the n-th presentation order is obtained from its
+	 * Lehmer code n. The associated probabilities are stored in resProba. y_ is modified. */
+	void probaYgX(const RankVal& mu, Real pi, Vector<Vector<int> >& resVec,
+			Vector<Real>& resProba);
 
-	bool checkMissingType(const Vector<bool>& acceptedType) const;
+	/**
+	 * Exact log-probability of x_, marginalized over the presentation orders. The sum over the nbPos! presentation orders is
+	 * computed by dynamic programming over the 2^nbPos sets of elements already presented, see maxNbPosExactRank.
+	 * @param mu central rank
+	 * @param pi precision */
+	Real lnMarginalProbability(const RankVal& mu, Real pi) const;
 
-	/** Provide a list of possible values for a position considering the observed value and the set of
-	 * possible values remaining. */
-	std::list<int> candidateList(int currPos,
-			const std::set<int>& remainingMod) const;
+	/**
+	 * Estimation of the log-probability of x_, marginalized over the presentation orders, by sequential importance sampling of
+	 * the presentation orders. Sampling stops when the estimated relative standard error of the probability is lower than
+	 * relError, or after nbSampleMax samples.
+	 * @param mu central rank
+	 * @param pi precision
+	 * @param relError target relative standard error
+	 * @param nbSampleMax maximum number of samples */
+	Real lnMarginalProbability(const RankVal& mu, Real pi, Real relError, int nbSampleMax);
 
-	/** Recursive function called by enumAllCompleted.
-	 *
-	 * @param currPos current position in the rank
-	 * @param remainingMod set of modalities that have not yet been seen in the rank
-	 * @param completedVec the completed rank from which recEnumComplete was called (complement remainingMod)
-	 * @return The list of all the possible RankVal enumerated in sub calls */
-	std::list<RankVal> recEnumComplete(int currPos,
-			const std::set<int>& remainingMod,
-			const Vector<int>& completedVec) const;
+	bool checkMissingType(const Vector<bool>& acceptedType) const;
 
 	/** Use the obsData_ information to compute all the possible completions for the individual. If there is no
 	 * partially observed data, the method still is useful at providing a check of the observed individual. For
@@ -168,6 +170,21 @@ public:
 	 * data is invalid, for example in the case 1,1,3. */
 	std::list<RankVal> enumCompleted() const;
 
+	/** Same as enumCompleted, the completions being identified by their RankVal::code, in increasing order. The
+	 * enumeration is performed on first use only, and the result is kept until setObsData is called. */
+	const std::vector<Index>& completed() const;
+
+	/** Provide the completions computed for another individual with the same observed data, so that they are
+	 * stored only once, see parseRankStr. */
+	void setCompleted(const std::shared_ptr<const std::vector<Index> >& completed) {
+		completed_ = completed;
+	}
+
+	std::shared_ptr<const std::vector<Index> > completedPtr() const {
+		completed();
+		return completed_;
+	}
+
 	/** Is the individual completely observed ? This is used to determine if statistics for a partially observed
 	 * individual have to be computed / exported */
 	bool allPresent() const {
@@ -189,6 +206,26 @@ private:
 	/** Is a value authorized for a particular MisVal describing */
 	bool isAuthorized(int value, const MisVal& misval) const;
 
+	/** Recursive function called by completed.
+	 *
+	 * @param currPos current position in the rank
+	 * @param remainingMod bit mask of the modalities that have not yet been seen in the rank
+	 * @param code Lehmer code of the positions before currPos
+	 * @param authorizedMod bit mask of the modalities compatible with the observation, for each position
+	 * @param completed codes of all the completions enumerated in sub calls */
+	void recEnumCompleted(int currPos, Index remainingMod, Index code,
+			const Vector<Index>& authorizedMod,
+			std::vector<Index>& completed) const;
+
+	/** For each modality, bit mask of the positions in x_ of the modalities preceding it in mu */
+	void muLessMask(const RankVal& mu, Index* muLess) const;
+
+	/**
+	 * Number of comparisons a and of correct comparisons g when currY is inserted in the insertion sort.
+	 * @param placed bit mask of the positions in x_ of the elements already presented
+	 * @param muLess see muLessMask */
+	void insertionAG(Index placed, int currY, const RankVal& mu, const Index* muLess, int& a, int& g) const;
+
 	/** Number of positions in the rank */
 	int nbPos_;
 
@@ -211,6 +248,12 @@ private:
 	bool allPresent_;
 
 	bool allMissing_;
+
+	/** Codes of all the possible completions, see completed. Can be shared between individuals. */
+	mutable std::shared_ptr<const std::vector<Index> > completed_;
+
+	/** Partially built ordering in xGen, kept as a member so that its storage is reused between calls */
+	std::vector<int> xGenBuffer_;
 };
 
 } // namespace mixt
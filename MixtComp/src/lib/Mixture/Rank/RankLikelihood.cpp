@@ -22,7 +22,7 @@
 
 #include <Mixture/Rank/RankLikelihood.h>
 #include <Various/Constants.h>
-#include <iostream>
+#include <cmath>
 
 
 namespace mixt {
@@ -31,33 +31,39 @@ void RankLikelihood::init(int nbInd, int nbClass, int nbObs) {
 	nbClass_ = nbClass;
 	nbObs_ = nbObs;
 
-	storage_.resize(nbInd_, nbClass_);
-	for (int k = 0; k < nbClass_; ++k) {
-		for (int i = 0; i < nbInd_; ++i) {
-			storage_(i, k).clear();
-			storage_(i, k).reserve(nbObs_);
-		}
-	}
+	logSumInv_.resize(nbInd_, nbClass_);
+	logSumInv_ = minInf;
+	count_.resize(nbInd_, nbClass_);
+	count_ = 0;
 }
 
 void RankLikelihood::observe(int i, int k, Real val) {
-	storage_(i, k).push_back(val);
+	observeLog(i, k, std::log(val));
+}
+
+void RankLikelihood::observeLog(int i, int k, Real logVal) {
+	Real logInv = -logVal;
+	Real& logSum = logSumInv_(i, k);
+
+	if (count_(i, k) == 0) {
+		logSum = logInv;
+	} else if (logSum < logInv) { // log(exp(a) + exp(b)) is computed relatively to the largest term
+		logSum = logInv + std::log1p(std::exp(logSum - logInv));
+	} else {
+		logSum = logSum + std::log1p(std::exp(logInv - logSum));
+	}
+
+	++count_(i, k);
 }
 
 void RankLikelihood::getHMean(Matrix<Real>& mat) const {
 	mat.resize(nbInd_, nbClass_);
 	for (int k = 0; k < nbClass_; ++k) {
 		for (int i = 0; i < nbInd_; ++i) {
-			if (storage_(i, k).size() == 0) {
+			if (count_(i, k) == 0) {
 				mat(i, k) = minInf;
 			} else {
-				Real val = 0.;
-				for (std::vector<Real>::const_iterator it =
-						storage_(i, k).begin(), itEnd = storage_(i, k).end();
-						it != itEnd; ++it) {
-					val += 1. / *it;
-				}
-				mat(i, k) = -std::log(val / Real(storage_(i, k).size()));
+				mat(i, k) = -(logSumInv_(i, k) - std::log(Real(count_(i, k))));
 			}
 		}
 	}
@@ -24,19 +24,23 @@
 #define RANKLIKELIHOOD_H
 
 #include <LinAlg/LinAlg.h>
-#include <vector>
 
 
 namespace mixt {
 
 /** Harmonic mean estimator of the marginal likelihood from observations of the
- * conditional likelihood */
+ * conditional likelihood. The observations are not stored: for each individual and class, the
+ * logarithm of the sum of their inverses is accumulated on-line, so that memory does not grow
+ * with the number of observations. */
 class RankLikelihood {
 public:
 	void init(int nbInd, int nbClass, int nbObs);
 
 	void observe(int i, int k, Real val);
 
+	/** Same as observe, with the logarithm of the conditional likelihood */
+	void observeLog(int i, int k, Real logVal);
+
 	void getHMean(Matrix<Real>& mat) const;
 
 private:
@@ -44,7 +48,11 @@ private:
 	int nbClass_;
 	int nbObs_;
 
-	Matrix<std::vector<Real> > storage_;
+	/** Logarithm of the sum of the inverses of the observations */
+	Matrix<Real> logSumInv_;
+
+	/** Number of observations */
+	Matrix<int> count_;
 };
 
 } // namespace mixt
@@ -114,6 +114,7 @@ public:
 	 * observed values of the class, while pi is initialized to a "neutral" value.
 	 * */
 	std::string mStep(const Vector<std::set<Index> >& classInd) {
+#pragma omp parallel for schedule(dynamic) // each class samples mu with its own random generator, so that the result does not depend on the scheduling
 		for (int k = 0; k < nClass_; ++k) {
 			class_[k].mStep(classInd(k));
 		}
@@ -265,12 +266,14 @@ public:
 		return warnLog;
 	}
 
-	void exportDataParam() const {
-		NamedMatrix<int> exportData(nInd_, nbPos_, false);
-		for (Index i = 0; i < nInd_; ++i) {
-			exportData.mat_.row(i) = data_(i).x().o();
+	void exportDataParam(const OutputSelection& os) const {
+		if (os.completed_) {
+			NamedMatrix<int> exportData(nInd_, nbPos_, false);
+			for (Index i = 0; i < nInd_; ++i) {
+				exportData.mat_.row(i) = data_(i).x().o();
+			}
+			outG_.add_payload( { "variable", "data", idName_ }, "completed", exportData);
 		}
-		outG_.add_payload( { "variable", "data", idName_ }, "completed", exportData);
 
 		outG_.add_payload( { "variable", "param", idName_ }, "paramStr", paramStr_);
 
@@ -291,37 +294,57 @@ public:
 			outG_.add_payload( { "variable", "param", idName_, "mu", "stat", "k: " + std::to_string(k + minModality) }, "proba", proba);
 		}
 
-		for (Index k = 0; k < nClass_; ++k) { // log of mu is also exported class by class
-			const Vector<RankVal>& muLogStorage = muParamStat_[k].logStorageMu();
-			Index nIt = muLogStorage.size();
-
-			NamedMatrix<int> rank(nIt, nbPos_, false);
-
-			for (Index i = 0; i < nIt; ++i) {
-				rank.mat_.row(i) = muLogStorage(i).o() + minModality;
-			}
-
-			outG_.add_payload( { "variable", "param", idName_, "mu", "log" }, "k: " + std::to_string(k + minModality), rank);
-		}
-
 		Index nStat = piParamStat_.getStatStorage().cols();
 		std::vector<std::string> colNames;
 		quantileNames(nStat, confidenceLevel_, colNames);
 		NamedMatrix<Real> piStatStorage = NamedMatrix<Real>( { piParamNames(), colNames, piParamStat_.getStatStorage() });
 		outG_.add_payload( { "variable", "param", idName_, "pi" }, "stat", piStatStorage);
 
-		NamedMatrix<Real> piLogStorage = {piParamNames(), std::vector<std::string>(), piParamStat_.getLogStorage() };
-		outG_.add_payload( { "variable", "param", idName_, "pi" }, "log", piLogStorage);
+		if (os.paramLog_) {
+			for (Index k = 0; k < nClass_; ++k) { // log of mu is also exported class by class
+				const Vector<RankVal>& muLogStorage = muParamStat_[k].logStorageMu();
+				Index nIt = muLogStorage.size();
+
+				NamedMatrix<int> rank(nIt, nbPos_, false);
+
+				for (Index i = 0; i < nIt; ++i) {
+					rank.mat_.row(i) = muLogStorage(i).o() + minModality;
+				}
+
+				outG_.add_payload( { "variable", "param", idName_, "mu", "log" }, "k: " + std::to_string(k + minModality), rank);
+			}
+
+			NamedMatrix<Real> piLogStorage = { piParamNames(), std::vector<std::string>(), piParamStat_.getLogStorage() };
+			outG_.add_payload( { "variable", "param", idName_, "pi" }, "log", piLogStorage);
+		}
 	}
 
 	void computeObservedProba() {
+		for (Index i = 0; i < nInd_; ++i) { // completions are enumerated lazily, this must be done before the classes share the data
+			if (!data_(i).allMissing()) {
+				data_(i).completed();
+			}
+		}
+
+		std::vector<RankIndividual> observedInd; // one per class, created here so that their seeds do not depend on the scheduling of the threads
+		observedInd.reserve(nClass_);
 		for (int k = 0; k < nClass_; ++k) {
-			class_[k].computeObservedProba();
+			observedInd.emplace_back(nbPos_);
+		}
+
+#pragma omp parallel for schedule(dynamic) // each class uses its own random number generator
+		for (int k = 0; k < nClass_; ++k) {
+			class_[k].computeObservedProba(observedInd[k]);
 		}
 	}
 
 	bool sampleApproximationOfObservedProba() {
-		return true;
+		for (int k = 0; k < nClass_; ++k) {
+			if (!class_[k].isObservedProbaExact()) {
+				return true;
+			}
+		}
+		return false;
 	}
 private:
 	std::string checkMissingType() {
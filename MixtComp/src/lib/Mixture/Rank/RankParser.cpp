@@ -20,11 +20,15 @@
  *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
+#include <map>
+#include <memory>
+#include <vector>
 #include <boost/algorithm/string.hpp>
 #include <Mixture/Rank/RankParser.h>
 
 #include "../../IO/MisValParser.h"
 #include "../../IO/IO.h"
+#include "../../Various/Constants.h"
 
 namespace mixt {
 
@@ -38,11 +42,19 @@ std::string parseRankStr(const std::vector<std::string>& vecStr, int minMod, int
 
 	MisValParser<int> mvp(-minMod);
 
+	std::map<std::vector<MisVal>, std::shared_ptr<const std::vector<Index> > > completedPerObs; // individuals with the same observed data share their completions
+
 	std::vector<std::string> strs;
 	boost::split(strs, vecStr[0], // number of modalities is deduced from the first individual and a warning will be triggered if that is not the case
 	boost::is_any_of(rankPosSep));
 	nbPos = strs.size();
 
+	if (maxNbPosRank < nbPos) {
+		std::stringstream sstm;
+		sstm << "Rank variables can have at most " << maxNbPosRank << " positions, the first individual has " << nbPos << " positions." << std::endl;
+		return sstm.str();
+	}
+
 	for (int i = 0; i < nbInd; ++i) {
 		Vector<int> o(nbPos);
 		Vector<MisVal> obsData(nbPos);
@@ -118,7 +130,25 @@ std::string parseRankStr(const std::vector<std::string>& vecStr, int minMod, int
 		vecInd(i).setO(o);
 		vecInd(i).setObsData(obsData);
 
-		if (vecInd(i).enumCompleted().size() == 0) {
+		if (vecInd(i).allMissing()) { // any completion is valid, and enumerating them is not needed
+			continue;
+		}
+
+		std::vector<MisVal> key(obsData.begin(), obsData.end()); // the observed values are part of the key, as they define the completions of present positions
+		for (int p = 0; p < nbPos; ++p) {
+			if (key[p].first == present_) {
+				key[p].second.assign(1, o(p));
+			}
+		}
+
+		std::map<std::vector<MisVal>, std::shared_ptr<const std::vector<Index> > >::const_iterator itC = completedPerObs.find(key);
+		if (itC == completedPerObs.end()) {
+			completedPerObs[key] = vecInd(i).completedPtr();
+		} else {
+			vecInd(i).setCompleted(itC->second);
+		}
+
+		if (vecInd(i).completed().size() == 0) {
 #ifdef MC_DEBUG
 			std::cout << "o: " << itString(o) << std::endl;
 			std::cout << "obsData: " << std::endl;
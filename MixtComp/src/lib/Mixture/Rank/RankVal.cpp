@@ -71,11 +71,42 @@ void RankVal::setNbPos(int nbPos) {
 	ranking_.resize(nbPos);
 }
 
-void RankVal::switchRepresentation(const Vector<int>& mu,
-		Vector<int>& muP) const {
-	for (int p = 0; p < nbPos_; ++p) {
-		muP(mu(p)) = p;
+Index RankVal::code() const {
+	Index code = 0;
+	for (int p = 0; p < nbPos_; ++p) { // factorial number system, the digit at position p counts the smaller modalities on its right
+		Index digit = 0;
+		for (int q = p + 1; q < nbPos_; ++q) {
+			if (ordering_(q) < ordering_(p)) {
+				++digit;
+			}
+		}
+		code = code * (nbPos_ - p) + digit;
 	}
+	return code;
+}
+
+void RankVal::setCode(Index code) {
+	for (int p = nbPos_ - 1; 0 <= p; --p) { // digits of the factorial number system, stored temporarily in ordering_
+		ordering_(p) = code % (nbPos_ - p);
+		code /= (nbPos_ - p);
+	}
+
+	Index remainingMod = (Index(1) << nbPos_) - 1;
+	for (int p = 0; p < nbPos_; ++p) { // the digit is the number of smaller modalities still available
+		int m = 0;
+		for (int digit = ordering_(p); ; ++m) {
+			if (remainingMod & (Index(1) << m)) {
+				if (digit == 0) {
+					break;
+				}
+				--digit;
+			}
+		}
+		ordering_(p) = m;
+		remainingMod &= ~(Index(1) << m);
+	}
+
+	switchRepresentation(ordering_, ranking_);
 }
 
 void RankVal::permutation(int firstElem) {
@@ -24,10 +24,17 @@
 #define RANKVAL_H
 
 #include <LinAlg/LinAlg.h>
+#include <Various/Constants.h>
 #include <iostream>
 
 namespace mixt {
 
+/**
+ * Storage of a representation of a rank. Its capacity is fixed to maxNbPosRank, so that the elements are stored inline and
+ * that creating or copying a RankVal never allocates.
+ */
+typedef Eigen::Matrix<int, Eigen::Dynamic, 1, Eigen::ColMajor, maxNbPosRank, 1> RankVec;
+
 /**
  * Both ordering (position -> modality) and ranking (modality -> position) are used in the RankCluster
  * algorithm. RankVal stores and update both representations, allowing easy operations on rank values. It
@@ -62,7 +69,7 @@ public:
 	void setO(const T& data) {
 		typename T::const_iterator itD = data.begin();
 		typename T::const_iterator itDE = data.end();
-		Vector<int>::iterator itV = ordering_.begin();
+		RankVec::iterator itV = ordering_.begin();
 
 		for (; itD != itDE; ++itD, ++itV) {
 			*itV = *itD;
@@ -79,7 +86,7 @@ public:
 	void setR(const T& data) {
 		typename T::const_iterator itD = data.begin();
 		typename T::const_iterator itDE = data.end();
-		Vector<int>::iterator itV = ranking_.begin();
+		RankVec::iterator itV = ranking_.begin();
 
 		for (; itD != itDE; ++itD, ++itV) {
 			*itV = *itD;
@@ -88,21 +95,35 @@ public:
 		switchRepresentation(ranking_, ordering_);
 	}
 
-	void switchRepresentation(const Vector<int>& mu, Vector<int>& muP) const;
+	template<typename T, typename U>
+	void switchRepresentation(const T& mu, U& muP) const {
+		for (int p = 0; p < nbPos_; ++p) {
+			muP(mu(p)) = p;
+		}
+	}
 
 	/**
 	 * Permutation of contiguous elements
 	 * @param firstElem index of the first element in ordering representation */
 	void permutation(int firstElem);
 
-	const Vector<int>& o() const {
+	const RankVec& o() const {
 		return ordering_;
 	}
 
-	const Vector<int>& r() const {
+	const RankVec& r() const {
 		return ranking_;
 	}
 
+	/**
+	 * Lehmer code of the ordering, which is its index among all the permutations of nbPos elements in lexicographic order. It
+	 * identifies a rank by a single integer, which is used as a key in hash tables. Only valid for nbPos <= maxNbPosRank.
+	 */
+	Index code() const;
+
+	/** Set the ordering from its Lehmer code, see code. */
+	void setCode(Index code);
+
 	friend std::ostream& operator<<(std::ostream& os, const RankVal& rv);
 
 	std::string str() const;
@@ -111,10 +132,10 @@ private:
 	int nbPos_;
 
 	/** ordering representation */
-	Vector<int> ordering_;
+	RankVec ordering_;
 
 	/** ranking representation */
-	Vector<int> ranking_;
+	RankVec ranking_;
 };
 
 std::ostream& operator<<(std::ostream& os, const RankVal& rv);
@@ -91,4 +91,11 @@ void CategoricalSampler::samplingStepNoCheck(int i,
     augData_.data_(i) = sampleVal;
   }
 }
+void CategoricalSampler::samplingStepNoCheck(const Vector<Index>& z) {
+#pragma omp parallel for
+  for (Index i = 0; i < z.size(); ++i) {
+    samplingStepNoCheck(i, z(i));
+  }
+}
+
 } // namespace mixt
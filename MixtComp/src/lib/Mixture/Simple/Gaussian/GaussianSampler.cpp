@@ -20,6 +20,9 @@
  *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
+#include <limits>
+#include <vector>
+
 #include <Mixture/IMixture.h>
 #include "GaussianSampler.h"
 
@@ -83,4 +86,54 @@ void GaussianSampler::samplingStepNoCheck(int i,
   }
 }
 
+void GaussianSampler::samplingStepNoCheck(const Vector<Index>& z) {
+  std::vector<Index> interval; // individuals with a value missing in an interval, bounded on at least one side
+  for (Index i = 0; i < z.size(); ++i) {
+    MisType type = augData_.misData_(i).first;
+    if (type == missingIntervals_ || type == missingLUIntervals_ || type == missingRUIntervals_) {
+      interval.push_back(i);
+    } else {
+      samplingStepNoCheck(i, z(i));
+    }
+  }
+
+  Index nInterval = interval.size();
+  Vector<Real> mean(nInterval);
+  Vector<Real> sd(nInterval);
+  Vector<Real> infBound(nInterval, -std::numeric_limits<Real>::infinity());
+  Vector<Real> supBound(nInterval, std::numeric_limits<Real>::infinity());
+
+  for (Index j = 0; j < nInterval; ++j) {
+    Index i = interval[j];
+    mean(j) = param_(2 * z(i)    );
+    sd(j)   = param_(2 * z(i) + 1);
+
+    const std::vector<Real>& bound = augData_.misData_(i).second;
+    switch(augData_.misData_(i).first) {
+      case missingIntervals_: {
+        infBound(j) = bound[0];
+        supBound(j) = bound[1];
+      }
+      break;
+
+      case missingLUIntervals_: {
+        supBound(j) = bound[0];
+      }
+      break;
+
+      default: { // missingRUIntervals_
+        infBound(j) = bound[0];
+      }
+      break;
+    }
+  }
+
+  Vector<Real> sampled;
+  normal_.sampleI(mean, sd, infBound, supBound, sampled);
+
+  for (Index j = 0; j < nInterval; ++j) {
+    augData_.data_(interval[j]) = sampled(j);
+  }
+}
+
 } // namespace mixt
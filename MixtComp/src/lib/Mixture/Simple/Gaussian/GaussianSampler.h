@@ -41,6 +41,12 @@ class GaussianSampler
 
     void samplingStepNoCheck(int i,
                              int z_i);
+
+    /**
+     * Sample the missing values of all individuals, z being the class of each individual. The values missing in
+     * intervals are sampled together, see NormalStatistic::sampleI.
+     */
+    void samplingStepNoCheck(const Vector<Index>& z);
   private:
     AugmentedData<Vector<Real> >& augData_;
 
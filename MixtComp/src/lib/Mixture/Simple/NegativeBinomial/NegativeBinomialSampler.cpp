@@ -63,4 +63,11 @@ void NegativeBinomialSampler::samplingStepNoCheck(int i, int z_i) {
   }
 }
 
+void NegativeBinomialSampler::samplingStepNoCheck(const Vector<Index>& z) {
+#pragma omp parallel for
+  for (Index i = 0; i < z.size(); ++i) {
+    samplingStepNoCheck(i, z(i));
+  }
+}
+
 } // namespace mixt
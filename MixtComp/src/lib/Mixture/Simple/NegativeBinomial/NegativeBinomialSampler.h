@@ -40,6 +40,9 @@ class NegativeBinomialSampler
 
     void samplingStepNoCheck(int i,
                              int z_i);
+
+    /** Sample the missing values of all individuals, z being the class of each individual. */
+    void samplingStepNoCheck(const Vector<Index>& z);
   private:
     AugmentedData<Vector<int> >& augData_;
 
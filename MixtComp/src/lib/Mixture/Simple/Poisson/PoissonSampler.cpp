@@ -62,4 +62,11 @@ void PoissonSampler::samplingStepNoCheck(int i, int z_i) {
   }
 }
 
+void PoissonSampler::samplingStepNoCheck(const Vector<Index>& z) {
+#pragma omp parallel for
+  for (Index i = 0; i < z.size(); ++i) {
+    samplingStepNoCheck(i, z(i));
+  }
+}
+
 } // namespace mixt
@@ -41,6 +41,9 @@ class PoissonSampler
 
     void samplingStepNoCheck(int i,
                              int z_i);
+
+    /** Sample the missing values of all individuals, z being the class of each individual. */
+    void samplingStepNoCheck(const Vector<Index>& z);
   private:
     AugmentedData<Vector<int> >& augData_;
 
@@ -56,9 +56,15 @@ public:
 	std::string setDataParam(RunMode mode) {
 		std::string warnLog;
 
-		std::vector<std::string> dataVecStr;
-		dataG_.get_payload( { }, idName_, dataVecStr);
-		warnLog += StringToAugmentedData(idName_, dataVecStr, augData_, (model_.hasModalities()) ? (-minModality) : (0));
+		if (dataG_.is_numeric_payload( { }, idName_)) { // numeric columns are read directly, without string parsing
+			Vector<Real> dataVecNum;
+			dataG_.get_payload( { }, idName_, dataVecNum);
+			warnLog += NumericToAugmentedData(idName_, dataVecNum, augData_, (model_.hasModalities()) ? (-minModality) : (0));
+		} else {
+			std::vector<std::string> dataVecStr;
+			dataG_.get_payload( { }, idName_, dataVecStr);
+			warnLog += StringToAugmentedData(idName_, dataVecStr, augData_, (model_.hasModalities()) ? (-minModality) : (0));
+		}
 
 		if (warnLog.size() > 0) {
 			return warnLog;
@@ -97,6 +103,10 @@ public:
 		sampler_.samplingStepNoCheck(ind, k);
 	}
 
+	void sampleAllUnobservedAndLatent(const Vector<Index>& z) {
+		sampler_.samplingStepNoCheck(z);
+	}
+
 	/**
 	 * Estimate parameters by maximum likelihood
 	 */
@@ -154,13 +164,15 @@ public:
 		model_.writeParameters();
 	}
 
-	void exportDataParam() const {
-		NamedVector<typename Model::Data::Type> dataOut;
-		dataOut.vec_ = augData_.data_; // not that no row names are provided
-		if (model_.hasModalities()) {
-			dataOut.vec_ += minModality;
+	void exportDataParam(const OutputSelection& os) const {
+		if (os.completed_) {
+			NamedVector<typename Model::Data::Type> dataOut;
+			dataOut.vec_ = augData_.data_; // not that no row names are provided
+			if (model_.hasModalities()) {
+				dataOut.vec_ += minModality;
+			}
+			outG_.add_payload( { "variable", "data", idName_ }, "completed", dataOut);
 		}
-		outG_.add_payload( { "variable", "data", idName_ }, "completed", dataOut);
 
 		Index ncol = paramStat_.getStatStorage().cols();
 		std::vector<std::string> colNames(ncol);
@@ -172,13 +184,15 @@ public:
 		paramStatOut.rowNames_ = model_.paramNames();
 		paramStatOut.colNames_ = colNames;
 
-		NamedMatrix<Real> paramLogOut;
-		paramLogOut.mat_ = paramStat_.getLogStorage();
-		paramLogOut.rowNames_ = model_.paramNames();
-
 		outG_.add_payload( { "variable", "param", idName_ }, "stat", paramStatOut);
-		outG_.add_payload( { "variable", "param", idName_ }, "log", paramLogOut);
 		outG_.add_payload( { "variable", "param", idName_ }, "paramStr", paramStr_);
+
+		if (os.paramLog_) {
+			NamedMatrix<Real> paramLogOut;
+			paramLogOut.mat_ = paramStat_.getLogStorage();
+			paramLogOut.rowNames_ = model_.paramNames();
+			outG_.add_payload( { "variable", "param", idName_ }, "log", paramLogOut);
+		}
 	}
 
 	void initData(Index i) {
@@ -62,4 +62,11 @@ void WeibullSampler::samplingStepNoCheck(Index i, Index z_i) {
 	}
 }
 
+void WeibullSampler::samplingStepNoCheck(const Vector<Index>& z) {
+#pragma omp parallel for
+	for (Index i = 0; i < z.size(); ++i) {
+		samplingStepNoCheck(i, z(i));
+	}
+}
+
 } // namespace mixt
@@ -34,6 +34,9 @@ class WeibullSampler {
     WeibullSampler(AugmentedData<Vector<Real> >& augData, const Vector<Real>& param, Index nbClass);
 
     void samplingStepNoCheck(Index i, Index z_i);
+
+    /** Sample the missing values of all individuals, z being the class of each individual. */
+    void samplingStepNoCheck(const Vector<Index>& z);
   private:
     AugmentedData<Vector<Real> >& augData_;
 
@@ -107,6 +107,19 @@ public:
 		}
 	}
 
+	/**
+	 * Overwrite the medians with the current parameters, when the parameters set by setExpectationParam had to be corrected, for example
+	 * to respect a constraint that the medians of the individual coefficients do not respect together. The exported medians are then the
+	 * parameters actually used.
+	 */
+	void setStatStorageParam() {
+		for (Index j = 0; j < nCols_; ++j) {
+			for (Index i = 0; i < nRows_; ++i) {
+				statStorage_(i * nCols_ + j, 0) = param_(i, j);
+			}
+		}
+	}
+
 	/**
 	 * Perform renormalization on statStorage. Useful for categorical modes where imputed parameters must
 	 * sum to 1
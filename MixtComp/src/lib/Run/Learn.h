@@ -51,6 +51,9 @@ void learn(const Graph& algo, const Graph& data, const Graph& desc, Graph& out)
 	// Create the composer and read the data
 	MixtureComposer composer(algo);
 
+	OutputSelection outputSelection;
+	warnLog += outputSelection.set(algo);
+
 	Timer readTimer("Read Data");
 	warnLog += createAllMixtures(algo, desc, data, param, out, composer);
 	warnLog += composer.setDataParam(learning_, data, param);
@@ -111,8 +114,8 @@ void learn(const Graph& algo, const Graph& data, const Graph& desc, Graph& out)
 	out.add_payload( { "mixture", "runTime" }, "GibbsBurnIn", timeGibbs.first);
 	out.add_payload( { "mixture", "runTime" }, "GibbsRun", timeGibbs.second);
 
-	composer.exportMixture(out);
-	composer.exportDataParam(out);
+	composer.exportMixture(out, outputSelection);
+	composer.exportDataParam(out, outputSelection);
 	out.addSubGraph( { }, "algo", algo);
 }
 
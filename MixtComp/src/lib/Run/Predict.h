@@ -52,6 +52,9 @@ void predict(const Graph& algo, const Graph& data, const Graph& desc, const Grap
 
 	MixtureComposer composer(algo);
 
+	OutputSelection outputSelection;
+	warnLog += outputSelection.set(algo);
+
 	Timer readTimer("Read Data");
 	warnLog += createAllMixtures(algo, desc, data, param, out, composer);
 	warnLog += composer.setDataParam(prediction_, data, param);
@@ -89,8 +92,8 @@ void predict(const Graph& algo, const Graph& data, const Graph& desc, const Grap
 	out.add_payload( { "mixture", "runTime" }, "GibbsBurnIn", timeGibbs.first);
 	out.add_payload( { "mixture", "runTime" }, "GibbsRun", timeGibbs.second);
 
-	composer.exportMixture(out);
-	composer.exportDataParam(out);
+	composer.exportMixture(out, outputSelection);
+	composer.exportDataParam(out, outputSelection);
 	out.addSubGraph({}, "algo", algo);
 }
 
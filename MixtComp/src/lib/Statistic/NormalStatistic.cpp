@@ -20,10 +20,14 @@
  *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
+#include <cmath>
 #include <ctime>
+#include <limits>
+#include <vector>
 #include <boost/random/variate_generator.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/math/distributions/normal.hpp>
+#include <boost/math/special_functions/erf.hpp>
 #include <Statistic/RNG.h>
 #include <Various/Constants.h>
 #include "NormalStatistic.h"
@@ -100,6 +104,52 @@ Real NormalStatistic::sampleSB(Real mean, Real sd, Real supBound) {
 	return z * sd + mean;
 }
 
+void NormalStatistic::sampleI(const Vector<Real>& mean, const Vector<Real>& sd, const Vector<Real>& infBound, const Vector<Real>& supBound, Vector<Real>& z) {
+	Index n = mean.size();
+	Real sqrt2 = std::sqrt(2.);
+	z.resize(n);
+
+	Vector<Real> lower = ((infBound - mean).array() / sd.array()).matrix();
+	Vector<Real> upper = ((supBound - mean).array() / sd.array()).matrix();
+	Vector<Real> sign(n);
+	Vector<Real> cdfLower(n);
+	Vector<Real> cdfUpper(n);
+
+	for (Index i = 0; i < n; ++i) { // intervals on the right of 0 are mirrored, so that the cdf is computed where it is accurate
+		sign(i) = (0. < lower(i)) ? -1. : 1.;
+		Real a = (0. < lower(i)) ? -upper(i) : lower(i);
+		Real b = (0. < lower(i)) ? -lower(i) : upper(i);
+		cdfLower(i) = 0.5 * std::erfc(-a / sqrt2);
+		cdfUpper(i) = 0.5 * std::erfc(-b / sqrt2);
+	}
+
+	std::vector<Index> rejected;
+	for (Index i = 0; i < n; ++i) {
+		Real p = cdfLower(i) + uniform_.sample(0., 1.) * (cdfUpper(i) - cdfLower(i));
+		Real currZ = (0. < p && p < 1.) ? -sqrt2 * boost::math::erfc_inv(2. * p) : std::numeric_limits<Real>::quiet_NaN();
+		currZ *= sign(i);
+
+		if (cdfLower(i) < cdfUpper(i) && lower(i) <= currZ && currZ <= upper(i)) {
+			z(i) = currZ * sd(i) + mean(i);
+		} else {
+			rejected.push_back(i);
+		}
+	}
+
+	for (std::vector<Index>::const_iterator it = rejected.begin(), itE = rejected.end(); it != itE; ++it) { // the remaining values use the rejection samplers
+		Index i = *it;
+		if (std::isinf(infBound(i)) && std::isinf(supBound(i))) {
+			z(i) = sample(mean(i), sd(i));
+		} else if (std::isinf(infBound(i))) {
+			z(i) = sampleSB(mean(i), sd(i), supBound(i));
+		} else if (std::isinf(supBound(i))) {
+			z(i) = sampleIB(mean(i), sd(i), infBound(i));
+		} else {
+			z(i) = sampleI(mean(i), sd(i), infBound(i), supBound(i));
+		}
+	}
+}
+
 Real NormalStatistic::lbSampler(Real lower) {
 	Real alpha = (lower + sqrt(pow(lower, 2) + 4.)) / 2.;
 	Real z, u, rho;
@@ -72,6 +72,18 @@ class NormalStatistic {
                   Real sd,
                   Real supBound);
 
+    /**
+     * Sample a vector of values, each from a Normal Law with parameters mean(i) and sd(i), conditionned on being in the interval
+     * [infBound(i); supBound(i)]. The bounds can be infinite. The values are obtained by inversion of the cdf, intervals lying
+     * entirely on the right of the mean being mirrored to keep the cdf away from 1. The few values for which the inversion is not
+     * accurate enough, for example in the far tails, are sampled afterwards with the scalar rejection samplers.
+     */
+    void sampleI(const Vector<Real>& mean,
+                 const Vector<Real>& sd,
+                 const Vector<Real>& infBound,
+                 const Vector<Real>& supBound,
+                 Vector<Real>& z);
+
     /** Compute expectation of a truncated normal law. Used in sampler debug for example. */
     void expSigmaTruncated(Real mu,
                            Real sigma,
@@ -25,9 +25,21 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "RNG.h"
+
 
 namespace mixt {
 
+namespace {
+
+/** Last identifier attributed to a SeedBase, 0 is never attributed. */
+std::atomic<Index> lastSeedBaseId(0);
+
+thread_local Index seedBaseId = 0;
+thread_local Index seedBase = 0;
+
+} // namespace
+
 bool deterministicMode() {
 	static const char *str_ptr = std::getenv(deterministicEnvVar);
 	static bool detMode = (str_ptr == NULL) ? (false) : (true);
@@ -48,4 +60,21 @@ int deterministicInitialSeed() {
 	}
 }
 
+SeedBase::SeedBase(Index base) {
+	seedBaseId = ++lastSeedBaseId;
+	seedBase = base;
+}
+
+SeedBase::~SeedBase() {
+	seedBaseId = 0;
+}
+
+Index SeedBase::id() {
+	return seedBaseId;
+}
+
+Index SeedBase::base() {
+	return seedBase;
+}
+
 } // namespace mixt
@@ -23,6 +23,7 @@
 #ifndef RNG_H
 #define RNG_H
 
+#include <atomic>
 #include <iostream>
 #include <time.h>
 
@@ -34,17 +35,43 @@ bool deterministicMode();
 
 int deterministicInitialSeed();
 
+/**
+ * Deterministic seeds of a run that must not depend on the runs executed concurrently by other threads, see streamPredict in JMixtComp.
+ * While a SeedBase exists, the random generators created by its thread draw their seeds from counters initialized to base, instead of
+ * the counters shared by all the threads. SeedBase objects must not be nested in a thread.
+ */
+class SeedBase {
+public:
+	explicit SeedBase(Index base);
+
+	~SeedBase();
+
+	/** Identifier of the SeedBase of the current thread, 0 if there is none. */
+	static Index id();
+
+	static Index base();
+};
+
 template<class T>
 std::size_t seed(const T* const p_caller) {
-	static Index nCall = deterministicInitialSeed();
+	static std::atomic<Index> nCall(deterministicInitialSeed()); // atomic, as runs can be executed concurrently, see streamPredict in JMixtComp
 
 	if (deterministicMode() == false) {
 		return size_t(p_caller) + time(0);
-	} else {
-		++nCall;
-		//	std::cout << "seed, nCall: " << nCall << std::endl;
-		return nCall;
 	}
+
+	if (SeedBase::id() != 0) {
+		thread_local Index baseId = 0; // SeedBase for which nBaseCall has been initialized
+		thread_local Index nBaseCall = 0;
+		if (baseId != SeedBase::id()) {
+			baseId = SeedBase::id();
+			nBaseCall = SeedBase::base();
+		}
+		return ++nBaseCall;
+	}
+
+	//	std::cout << "seed, nCall: " << nCall << std::endl;
+	return ++nCall;
 }
 
 } // namespace mixt
@@ -51,7 +51,7 @@ const Real minInf = std::log(0.);
 
 //const int sizeTupleBOS = 2;
 //const int nbGibbsIniBOS = 100;
-//const Real piInitBOS = 0.9;
+const Real piInitBOS = 0.75;
 //const Real piInitISR = 0.75;
 //const Real piThreshold = 0.05;
 
@@ -59,9 +59,13 @@ const int nbGibbsIterRankMStep = 50;
 const Index nbGibbsIniISR = 100;
 
 const int nbSampleObserved = 10000;
+const int nbSampleMinObserved = 100;
+const Real relErrorObservedRank = 0.01;
+const int maxNbPosExactRank = 16;
 
 const Index maxIterationOptim = 50;
 const Real relTolOptim = 0.0001;
+const Index blockSizeOptim = 1024;
 
 const std::string rankPosSep = ",";
 
@@ -50,7 +50,7 @@ extern const Real minInf; // value of log(0)
 
 //extern const int sizeTupleBOS; // default size of tuple for Gibbs sampling in BOS model
 //extern const int nbGibbsIniBOS; // number of Gibbs sampling rounds in initialization to increase variability on z
-//extern const Real piInitBOS; // value of pi used in Gibbs used in initialization
+extern const Real piInitBOS; // value of pi used in the initialization of the BOS paths and parameters
 //extern const Real piInitISR; // value of pi used in ISR initialization
 //extern const Real piThreshold; //threashold on pi to detect degeneracy
 
@@ -58,11 +58,16 @@ extern const int nbGibbsIterRankMStep; // number of iterations in the Gibbs used
 extern const Index nbGibbsIniISR; // number of iterations in the initializing Gibbs
 
 extern const int nbSampleObserved; // number of sample per class to estimate the observed probability, for example in Ordinal or Rank data
+extern const int nbSampleMinObserved; // minimum number of samples before the relative error of an estimated observed probability is checked
+extern const Real relErrorObservedRank; // target relative standard error of the estimated observed probabilities of Rank completions
+extern const int maxNbPosExactRank; // maximum number of positions for which the observed probabilities of Rank completions can be computed exactly, as 2^nbPos values are stored, see RankClass::isExactObservedProbaCheaper
 
 extern const Index maxIterationOptim; // maximum number of evaluation of cost function for optimization in Functional and in Weibull
 extern const Real relTolOptim;
+extern const Index blockSizeOptim; // number of time steps per block in the parallel evaluation of the cost function in Functional
 
 extern const std::string rankPosSep; // separator used in Rank positions
+const int maxNbPosRank = 20; // maximum number of positions in a Rank, so that the Lehmer code of a rank fits in an Index, see RankVal::code. Defined here as it sizes RankVec.
 
 extern const Index nCompletedInitTry;
 
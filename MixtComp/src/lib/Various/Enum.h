@@ -68,6 +68,11 @@ enum SamplerType {
   GibbsSampler_
 };
 
+enum OptimType {
+  BFGS_,
+  Newton_
+};
+
 } // namespace mixt
 
 #endif /* ENUM_H_ */
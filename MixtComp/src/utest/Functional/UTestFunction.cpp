@@ -87,7 +87,6 @@ TEST(Function, lnCompletedProbability) {
 		}
 
 		function.setVal(t, x, w);
-		function.computeVandermonde(nCoeff);
 
 		Real logProba = function.lnCompletedProbability(alpha, beta, sd);
 		if (mode < logProba) {
@@ -100,6 +99,91 @@ TEST(Function, lnCompletedProbability) {
 	ASSERT_NEAR(expectedMode, mode, 0.05);
 }
 
+TEST(FunctionalBatch, jointLogProba) {
+	SeedBase seedBase(0);
+	Index nInd = 2;
+	Index nClass = 2;
+	Index nSub = 2;
+	Index nCoeff = 2;
+
+	Vector<Function> data(nInd);
+
+	Vector<Real> t0(4);
+	t0 << 0., 1., 2., 3.;
+	Vector<Real> x0(4);
+	x0 << 1., 2., 6., 8.;
+	Vector<std::set<Index> > w0(nSub);
+	w0(0) = {0, 1};
+	w0(1) = {2, 3};
+	data(0).setVal(t0, x0, w0);
+
+	Vector<Real> t1(3);
+	t1 << 0., 1.5, 3.; // time values shared with the first individual are only stored once
+	Vector<Real> x1(3);
+	x1 << 2., 3., 9.;
+	Vector<std::set<Index> > w1(nSub);
+	w1(0) = {1};
+	w1(1) = {0, 2};
+	data(1).setVal(t1, x1, w1);
+
+	FunctionalBatch batch;
+	batch.set(data, nCoeff);
+	ASSERT_EQ(7, batch.nTime());
+	ASSERT_EQ(4, batch.offset(1));
+	ASSERT_EQ(5, batch.nUniqueTime());
+	ASSERT_EQ(batch.timeIndex()(0), batch.timeIndex()(4));
+	ASSERT_EQ(batch.timeIndex()(3), batch.timeIndex()(6));
+
+	std::vector<Matrix<Real> > alpha(nClass, Matrix<Real>(nSub, 2));
+	alpha[0] << 0., 0., -3., 2.;
+	alpha[1] << 1., -0.5, -1., 0.5;
+
+	std::vector<Matrix<Real> > beta(nClass, Matrix<Real>(nSub, nCoeff));
+	beta[0] << 1., 1., 0., 2.;
+	beta[1] << 2., 0.5, -1., 2.5;
+
+	std::vector<Vector<Real> > sd(nClass, Vector<Real>(nSub));
+	sd[0] << 0.5, 1.;
+	sd[1] << 1., 2.;
+
+	std::vector<FunctionalClass> classes;
+	for (Index k = 0; k < nClass; ++k) {
+		classes.emplace_back(data, 0.95);
+		classes[k].setSize(nSub, nCoeff);
+		classes[k].setParam(alpha[k], beta[k], sd[k]);
+	}
+	batch.refresh(classes);
+
+	for (Index i = 0; i < nInd; ++i) {
+		for (Index k = 0; k < nClass; ++k) {
+			ASSERT_NEAR(data(i).lnCompletedProbability(alpha[k], beta[k], sd[k]), data(i).lnCompletedProbability(batch.jointLogProba(), batch.offset(i), k * nSub), epsilon);
+			ASSERT_NEAR(data(i).lnObservedProbability(alpha[k], beta[k], sd[k]), data(i).lnObservedProbability(batch.jointLogProba(), batch.offset(i), k * nSub), epsilon);
+		}
+	}
+
+	beta[1](1, 0) = 1.; // modifying the parameters of a class must invalidate its part of the cache
+	classes[1].setParam(alpha[1], beta[1], sd[1]);
+	ASSERT_TRUE(batch.isUpToDate(classes, 0));
+	ASSERT_FALSE(batch.isUpToDate(classes, 1));
+	batch.refresh(classes);
+	ASSERT_TRUE(batch.isUpToDate(classes, 1));
+	for (Index i = 0; i < nInd; ++i) {
+		ASSERT_NEAR(data(i).lnCompletedProbability(alpha[1], beta[1], sd[1]), data(i).lnCompletedProbability(batch.jointLogProba(), batch.offset(i), nSub), epsilon);
+		ASSERT_NEAR(data(i).lnObservedProbability(alpha[1], beta[1], sd[1]), data(i).lnObservedProbability(batch.jointLogProba(), batch.offset(i), nSub), epsilon);
+	}
+
+	for (Index k = 0; k < nClass; ++k) { // alpha shared by all classes, as in FunctionalSharedAlphaMixture, log kappa is computed once
+		alpha[k] << 0., 0., 2., -1.;
+		classes[k].setParam(alpha[k], beta[k], sd[k]);
+	}
+	batch.refresh(classes);
+	for (Index i = 0; i < nInd; ++i) {
+		for (Index k = 0; k < nClass; ++k) {
+			ASSERT_NEAR(data(i).lnObservedProbability(alpha[k], beta[k], sd[k]), data(i).lnObservedProbability(batch.jointLogProba(), batch.offset(i), k * nSub), epsilon);
+		}
+	}
+}
+
 TEST(Function, removeMissingQuantile) {
 	Index nTime = 5;
 	Index nSub = 2;
@@ -121,9 +205,171 @@ TEST(Function, removeMissingQuantile) {
 	function.setVal(t, x, w);
 	function.removeMissingQuantile(quantile);
 
-	std::set<Index> w0 = { 0, 3, 4 };
-	std::set<Index> w1 = { 1, 2 };
+	Vector<Index> expectedLabel(nTime);
+	expectedLabel << 0, 1, 1, 0, 0;
+	ASSERT_EQ(expectedLabel, function.label());
+	ASSERT_EQ(3, function.count()(0));
+	ASSERT_EQ(2, function.count()(1));
+}
+
+TEST(Function, regStat) {
+	SeedBase seedBase(0);
+	Index nTime = 50;
+	Index nSub = 3;
+	Index nCoeff = 3;
+
+	UniformStatistic uni;
+	MultinomialStatistic multi;
+
+	Vector<Real> t(nTime);
+	Vector<Real> x(nTime);
+	Vector<std::set<Index> > w(nSub);
+	for (Index i = 0; i < nTime; ++i) {
+		t(i) = uni.sample(-5., 5.);
+		x(i) = uni.sample(-10., 10.);
+		w(multi.sampleInt(0, nSub - 1)).insert(i);
+	}
+
+	Function function;
+	function.setVal(t, x, w);
+	function.computeRegStat(nCoeff);
+
+	Matrix<Real> alpha(nSub, 2);
+	alpha << 0., 0., 1., 0.5, -1., -0.5;
+	Matrix<Real> beta(nSub, nCoeff);
+	beta << 1., 0., 0., -1., 1., 0., 0., 0., 1.;
+	Vector<Real> sd(nSub);
+	sd << 1., 2., 3.;
+	function.sampleWNoCheck(alpha, beta, sd); // statistics are updated incrementally for the time steps that changed subregression
+
+	Vector<std::set<Index> > sampledW(nSub);
+	for (Index i = 0; i < nTime; ++i) {
+		sampledW(function.label()(i)).insert(i);
+	}
+
+	Function reference; // statistics computed from scratch with the new labels
+	reference.setVal(t, x, sampledW);
+	reference.computeRegStat(nCoeff);
+
+	for (Index s = 0; s < nSub; ++s) { // the regression on the statistics must be identical to the regression on the design
+		Index nObs = function.count()(s);
+		ASSERT_EQ(nObs, function.regStat(s).n());
+
+		Vector<Real> subT(nObs);
+		Vector<Real> subX(nObs);
+		Index row = 0;
+		for (Index i = 0; i < nTime; ++i) {
+			if (function.label()(i) == s) {
+				subT(row) = t(i);
+				subX(row) = x(i);
+				++row;
+			}
+		}
+
+		Matrix<Real> design;
+		vandermondeMatrix(subT, nCoeff, design);
+		Vector<Real> betaDesign;
+		Real sdDesign;
+		regression(design, subX, betaDesign, sdDesign);
+
+		Vector<Real> betaStat;
+		Real rssStat;
+		function.regStat(s).regression(betaStat, rssStat);
+		ASSERT_TRUE(betaStat.isApprox(betaDesign, 1e-8));
+		ASSERT_NEAR(sdDesign, std::sqrt(rssStat / nObs), 1e-8);
+
+		Vector<Real> betaRef; // statistics updated incrementally and computed from scratch
+		Real rssRef;
+		reference.regStat(s).regression(betaRef, rssRef);
+		ASSERT_TRUE(betaStat.isApprox(betaRef, 1e-8));
+		ASSERT_NEAR(rssRef, rssStat, 1e-8 * rssRef);
+	}
+}
+
+/**
+ * The statistics of the time steps of several individuals, merged, must be identical to the statistics of all the time steps
+ * computed at once.
+ */
+TEST(Function, regStatMerge) {
+	SeedBase seedBase(0);
+	Index nTime = 30;
+	Index nInd = 4;
+	Index nCoeff = 3;
+
+	UniformStatistic uni;
+
+	Vector<Real> tAll(nInd * nTime);
+	Vector<Real> xAll(nInd * nTime);
+	RegStat merged;
+	merged.setSize(nCoeff);
+	for (Index i = 0; i < nInd; ++i) {
+		Vector<Real> t(nTime);
+		Vector<Real> x(nTime);
+		Vector<std::set<Index> > w(1);
+		for (Index j = 0; j < nTime; ++j) {
+			t(j) = uni.sample(-5., 5.) + 10. * i; // individuals with different means
+			x(j) = uni.sample(-10., 10.);
+			w(0).insert(j);
+			tAll(i * nTime + j) = t(j);
+			xAll(i * nTime + j) = x(j);
+		}
+
+		Function function;
+		function.setVal(t, x, w);
+		function.computeRegStat(nCoeff);
+		merged.merge(function.regStat(0));
+	}
+
+	Matrix<Real> design;
+	vandermondeMatrix(tAll, nCoeff, design);
+	Vector<Real> betaDesign;
+	Real sdDesign;
+	regression(design, xAll, betaDesign, sdDesign);
+
+	Vector<Real> betaStat;
+	Real rssStat;
+	merged.regression(betaStat, rssStat);
+
+	ASSERT_EQ(nInd * nTime, merged.n());
+	ASSERT_TRUE(betaStat.isApprox(betaDesign, 1e-8));
+	ASSERT_NEAR(sdDesign, std::sqrt(rssStat / (nInd * nTime)), 1e-8);
+}
+
+/**
+ * The standard deviation of a good fit with a large offset, for which y^T y - beta^T X^T y cancels, must be obtained with the same
+ * relative precision as with the regression on the design.
+ */
+TEST(Function, residualSumSquaresPrecision) {
+	SeedBase seedBase(0);
+	Index nTime = 1000;
+	Index nCoeff = 2;
+	Real sdNoise = 1e-3;
+
+	UniformStatistic uni;
+	NormalStatistic normal;
+
+	Vector<Real> t(nTime);
+	Vector<Real> x(nTime);
+	Vector<std::set<Index> > w(1);
+	for (Index i = 0; i < nTime; ++i) {
+		t(i) = uni.sample(0., 10.);
+		x(i) = 1.e6 + 2. * t(i) + normal.sample(0., sdNoise);
+		w(0).insert(i);
+	}
+
+	Function function;
+	function.setVal(t, x, w);
+	function.computeRegStat(nCoeff);
+
+	Vector<Real> beta;
+	Real rss;
+	function.regStat(0).regression(beta, rss);
+
+	Matrix<Real> design;
+	vandermondeMatrix(t, nCoeff, design);
+	Vector<Real> betaDesign;
+	Real sdDesign;
+	regression(design, x, betaDesign, sdDesign);
 
-	ASSERT_EQ(w0, function.w()(0));
-	ASSERT_EQ(w1, function.w()(1));
+	ASSERT_NEAR(sdDesign, std::sqrt(rss / nTime), 1e-2 * sdDesign);
 }
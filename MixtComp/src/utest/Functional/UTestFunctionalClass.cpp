@@ -149,7 +149,6 @@ TEST(FunctionalClass, optimOneclassMultiIndAlphaBetaSd) {
 		}
 
 		data(ind).setVal(t, x, w);
-		data(ind).computeVandermonde(nCoeff);
 		setInd.insert(ind);
 	}
 
@@ -192,16 +192,11 @@ TEST(FunctionalComputation, costAndGrad1SubReg) {
 	Index nParam = 2;
 	Real delta = epsilon;
 
-	Index nSub = nParam / 2;
-
 	Vector<Real> t(nTime);
 	t << 0., 1., 2., 3.;
 
-	Vector<std::set<Index> > w(nSub);
-	w(0).insert(0);
-	w(0).insert(1);
-	w(0).insert(2);
-	w(0).insert(3);
+	Vector<Index> label(nTime);
+	label << 0, 0, 0, 0;
 
 	Vector<Real> alpha0(2);
 	alpha0 << -1., 0.5;
@@ -215,9 +210,9 @@ TEST(FunctionalComputation, costAndGrad1SubReg) {
 
 	timeValue(t, nParam, alpha0, value, sumExpValue);
 
-	costFunction(t, value, sumExpValue, w, c0);
+	costFunction(t, value, sumExpValue, label, c0);
 
-	gradCostFunction(t, value, sumExpValue, w, computedGradVec);
+	gradCostFunction(t, value, sumExpValue, label, computedGradVec);
 
 	for (Index s = 0; s < nParam; ++s) {
 		Real c1;
@@ -229,7 +224,7 @@ TEST(FunctionalComputation, costAndGrad1SubReg) {
 
 		timeValue(t, nParam, alpha1, value, sumExpValue);
 
-		costFunction(t, value, sumExpValue, w, c1);
+		costFunction(t, value, sumExpValue, label, c1);
 
 		fdGrad(s) = (c1 - c0) / delta;
 	}
@@ -246,16 +241,11 @@ TEST(FunctionalComputation, costAndGrad) {
 	Index nParam = 4;
 	Real delta = epsilon;
 
-	Index nSub = nParam / 2;
-
 	Vector<Real> t(nTime);
 	t << 0., 1., 2., 3.;
 
-	Vector<std::set<Index> > w(nSub);
-	w(0).insert(0);
-	w(0).insert(1);
-	w(1).insert(2);
-	w(1).insert(3);
+	Vector<Index> label(nTime);
+	label << 0, 0, 1, 1;
 
 	Vector<Real> alpha0(4);
 	alpha0 << -1., 0.5, 1., -0.5;
@@ -269,9 +259,9 @@ TEST(FunctionalComputation, costAndGrad) {
 
 	timeValue(t, nParam, alpha0, value, sumExpValue);
 
-	costFunction(t, value, sumExpValue, w, c0);
+	costFunction(t, value, sumExpValue, label, c0);
 
-	gradCostFunction(t, value, sumExpValue, w, computedGradVec);
+	gradCostFunction(t, value, sumExpValue, label, computedGradVec);
 
 	for (Index s = 0; s < nParam; ++s) {
 		Real c1;
@@ -283,7 +273,7 @@ TEST(FunctionalComputation, costAndGrad) {
 
 		timeValue(t, nParam, alpha1, value, sumExpValue);
 
-		costFunction(t, value, sumExpValue, w, c1);
+		costFunction(t, value, sumExpValue, label, c1);
 
 		fdGrad(s) = (c1 - c0) / delta;
 	}
@@ -300,17 +290,11 @@ TEST(FunctionalComputation, hessian) {
 	Index nParam = 4;
 	Real delta = 1e-5;
 
-	Index nSub = nParam / 2;
-
 	Vector<Real> t(nTime);
-	Vector<std::set<Index> > w(nSub);
+	Vector<Index> label(nTime);
 	for (Index i = 0; i < nTime; ++i) {
 		t(i) = i;
-		if (i < nTime / 2) {
-			w(0).insert(i);
-		} else {
-			w(1).insert(i);
-		}
+		label(i) = (i < nTime / 2) ? 0 : 1;
 	}
 
 	Vector<Real> alpha0(4);
@@ -324,9 +308,9 @@ TEST(FunctionalComputation, hessian) {
 
 	timeValue(t, nParam, alpha0, value, sumExpValue);
 
-	costFunction(t, value, sumExpValue, w, c00);
+	costFunction(t, value, sumExpValue, label, c00);
 
-	hessianCostFunction(t, value, sumExpValue, w, computedHessian);
+	hessianCostFunction(t, value, sumExpValue, computedHessian);
 
 	for (Index row = 0; row < nParam; ++row) {
 		for (Index col = 0; col < nParam; ++col) {
@@ -341,7 +325,7 @@ TEST(FunctionalComputation, hessian) {
 			alpha1[row] += delta;
 
 			timeValue(t, nParam, alpha1, value, sumExpValue);
-			costFunction(t, value, sumExpValue, w, c10);
+			costFunction(t, value, sumExpValue, label, c10);
 
 			for (Index i = 0; i < nParam; ++i) {
 				alpha1[i] = alpha0[i];
@@ -349,7 +333,7 @@ TEST(FunctionalComputation, hessian) {
 			alpha1[col] += delta;
 
 			timeValue(t, nParam, alpha1, value, sumExpValue);
-			costFunction(t, value, sumExpValue, w, c01);
+			costFunction(t, value, sumExpValue, label, c01);
 
 			for (Index i = 0; i < nParam; ++i) {
 				alpha1[i] = alpha0[i];
@@ -358,7 +342,7 @@ TEST(FunctionalComputation, hessian) {
 			alpha1[col] += delta;
 
 			timeValue(t, nParam, alpha1, value, sumExpValue);
-			costFunction(t, value, sumExpValue, w, c11);
+			costFunction(t, value, sumExpValue, label, c11);
 
 			fdHessian(row, col) = (c11 - c01 - c10 + c00) / (delta * delta);
 		}
@@ -439,6 +423,165 @@ TEST(FunctionalComputation, optimRealSimpleCase) {
 	ASSERT_EQ(true, isApprox);
 }
 
+TEST(FunctionalComputation, funcProblem) {
+	SeedBase seedBase(0);
+	Index nInd = 3;
+	Index nTime = 500; // the total number of time steps spans several blocks of the parallel evaluation
+	Index nSub = 3;
+	Index nParam = 2 * nSub;
+	Index nFreeParam = 2 * (nSub - 1);
+
+	UniformStatistic uni;
+	MultinomialStatistic multi;
+
+	Vector<Function> data(nInd);
+	std::set<Index> setInd;
+	for (Index i = 0; i < nInd; ++i) {
+		Vector<Real> t(nTime);
+		Vector<Real> x(nTime, 0.); // not used in the cost function
+		Vector<std::set<Index> > w(nSub);
+		for (Index j = 0; j < nTime; ++j) {
+			t(j) = uni.sample(0., 10.);
+			w(multi.sampleInt(0, nSub - 1)).insert(j);
+		}
+		data(i).setVal(t, x, w);
+		setInd.insert(i);
+	}
+
+	Vector<Real> alpha(nParam);
+	alpha << 0., 0., 2., -0.5, -3., 0.4;
+
+	Vector<Real> freeAlpha(nFreeParam);
+	for (Index p = 0; p < nFreeParam; ++p) {
+		freeAlpha(p) = alpha(p + 2);
+	}
+
+	Real expectedValue = 0.;
+	Vector<Real> expectedGrad(nFreeParam, 0.);
+	Vector<Real> gradInd(nParam);
+	for (Index i = 0; i < nInd; ++i) {
+		expectedValue -= data(i).costAndGrad(alpha, gradInd);
+		for (Index p = 0; p < nFreeParam; ++p) {
+			expectedGrad(p) -= gradInd(p + 2);
+		}
+	}
+
+	FuncProblem fp(nParam, data, setInd);
+	Vector<Real> computedGrad(nFreeParam);
+	Real computedValue = fp.valueAndGradient(freeAlpha, computedGrad);
+
+	ASSERT_NEAR(expectedValue, computedValue, 1e-8);
+	ASSERT_TRUE(expectedGrad.isApprox(computedGrad, 1e-8));
+
+	Vector<Real> separateGrad(nFreeParam);
+	fp.gradient(freeAlpha, separateGrad);
+	ASSERT_EQ(computedValue, fp.value(freeAlpha));
+	ASSERT_TRUE(computedGrad == separateGrad);
+}
+
+TEST(FunctionalComputation, funcProblemHessian) {
+	SeedBase seedBase(0);
+	Index nTime = 50;
+	Index nSub = 3;
+	Index nParam = 2 * nSub;
+	Index nFreeParam = 2 * (nSub - 1);
+
+	UniformStatistic uni;
+	MultinomialStatistic multi;
+
+	Vector<Real> t(nTime);
+	Vector<Real> x(nTime, 0.);
+	Vector<std::set<Index> > w(nSub);
+	for (Index j = 0; j < nTime; ++j) {
+		t(j) = uni.sample(0., 10.);
+		w(multi.sampleInt(0, nSub - 1)).insert(j);
+	}
+
+	Vector<Function> data(1);
+	data(0).setVal(t, x, w);
+	std::set<Index> setInd;
+	setInd.insert(0);
+
+	Vector<Real> alpha(nParam);
+	alpha << 0., 0., 2., -0.5, -3., 0.4;
+
+	Vector<Real> freeAlpha(nFreeParam);
+	for (Index p = 0; p < nFreeParam; ++p) {
+		freeAlpha(p) = alpha(p + 2);
+	}
+
+	Matrix<Real> logValue;
+	Vector<Real> logSumExpValue;
+	Matrix<Real> expectedHessian;
+	timeValue(t, nParam, alpha, logValue, logSumExpValue);
+	hessianCostFunction(t, logValue, logSumExpValue, expectedHessian);
+
+	FuncProblem fp(nParam, data, setInd);
+	FuncProblem::THessian computedHessian;
+	fp.hessian(freeAlpha, computedHessian);
+
+	for (Index row = 0; row < nFreeParam; ++row) {
+		for (Index col = 0; col < nFreeParam; ++col) {
+			ASSERT_NEAR(-expectedHessian(row + 2, col + 2), computedHessian(row, col), 1e-8);
+		}
+	}
+}
+
+TEST(FunctionalComputation, optimNewton) {
+	SeedBase seedBase(0);
+	Index nTime = 1000;
+	Index nSub = 2;
+	Real xMax = 100.;
+	Real alpha0 = -10.;
+	Real alphaSlope = - 2.0 * alpha0 / xMax;
+
+	Index nParam = 2 * nSub;
+	Index nFreeParam = 2 * (nSub - 1);
+
+	Vector<Real> t(nTime);
+	for (Index i = 0; i < nTime; ++i) {
+		t(i) = i * xMax / nTime;
+	}
+
+	Vector<Real> alpha(nParam);
+	alpha << 0., 0., alpha0, alphaSlope;
+
+	Matrix<Real> logValue;
+	Vector<Real> logSumExpValue;
+	timeValue(t, nParam, alpha, logValue, logSumExpValue);
+
+	MultinomialStatistic multi;
+	Vector<std::set<Index> > w(nSub);
+	Vector<Real> x(nTime, 0.); // not used in the estimation of alpha
+	for (Index i = 0; i < nTime; ++i) {
+		Vector<Real> kappa = logValue.row(i).expE() / std::exp(logSumExpValue(i));
+		w(multi.sample(kappa)).insert(i);
+	}
+
+	Vector<Function> data(1);
+	data(0).setVal(t, x, w);
+	std::set<Index> setInd;
+	setInd.insert(0);
+
+	FuncProblem fp(nParam, data, setInd);
+
+	cppoptlib::NewtonDescentSolver<FuncProblem> solver;
+	cppoptlib::Criteria<Real> crit = cppoptlib::Criteria<Real>::defaults();
+	crit.iterations = maxIterationOptim;
+	solver.setStopCriteria(crit);
+
+	Vector<Real> estimatedFreeAlpha(nFreeParam, 0.);
+	solver.minimize(fp, estimatedFreeAlpha);
+
+	Vector<Real> gradient(nFreeParam);
+	fp.gradient(estimatedFreeAlpha, gradient);
+	ASSERT_LT(gradient.norm(), 1e-4); // the optimum is reached
+
+	Vector<Real> expectedFreeAlpha(nFreeParam);
+	expectedFreeAlpha << alpha0, alphaSlope;
+	ASSERT_TRUE(estimatedFreeAlpha.isApprox(expectedFreeAlpha, 0.2));
+}
+
 TEST(FunctionalComputation, removeMissingQuantile) {
 	Index nInd = 250;
 	Index nTime = 1000;
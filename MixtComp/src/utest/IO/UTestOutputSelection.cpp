@@ -0,0 +1,56 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+TEST(OutputSelection, defaultIsComplete) {
+	OutputSelection os;
+	ASSERT_TRUE(os.IDClass_);
+	ASSERT_TRUE(os.delta_);
+	ASSERT_TRUE(os.lnProbaGivenClass_);
+	ASSERT_TRUE(os.completedProbabilityLog_);
+	ASSERT_TRUE(os.completed_);
+	ASSERT_TRUE(os.tik_);
+	ASSERT_TRUE(os.paramLog_);
+}
+
+TEST(OutputSelection, subset) {
+	OutputSelection os;
+	std::string warnLog = os.set( { "completed", "IDClass" });
+	ASSERT_EQ(0, warnLog.size());
+	ASSERT_TRUE(os.IDClass_);
+	ASSERT_FALSE(os.delta_);
+	ASSERT_FALSE(os.lnProbaGivenClass_);
+	ASSERT_FALSE(os.completedProbabilityLog_);
+	ASSERT_TRUE(os.completed_);
+	ASSERT_FALSE(os.tik_);
+	ASSERT_FALSE(os.paramLog_);
+}
+
+TEST(OutputSelection, unknownSection) {
+	OutputSelection os;
+	std::string warnLog = os.set( { "E_kj" });
+	ASSERT_LT(0, warnLog.size());
+}
@@ -0,0 +1,282 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+namespace {
+
+/** Parameters used in most tests, in the linearized format of MultivariateGaussianClass::setParam */
+void testParam(Eigen::VectorXd& mean, Eigen::MatrixXd& cov, Vector<Real>& param) {
+	mean.resize(3);
+	mean << 1., -1., 2.;
+
+	cov.resize(3, 3);
+	cov << 2., 0.5, 0.3,
+			0.5, 1.5, -0.4,
+			0.3, -0.4, 1.;
+
+	param.resize(9);
+	param << 1., -1., 2., 2., 0.5, 0.3, 1.5, -0.4, 1.;
+}
+
+Real lnDensityDirect(const Eigen::VectorXd& x, const Eigen::VectorXd& mean, const Eigen::MatrixXd& cov) {
+	Eigen::VectorXd centered = x - mean;
+	return -0.5 * x.size() * std::log(2. * pi) - 0.5 * std::log(cov.determinant()) - 0.5 * centered.dot(cov.inverse() * centered);
+}
+
+}
+
+/**
+ * The log densities computed in a batch must be equal to the densities of the individuals, computed directly.
+ */
+TEST(MultivariateGaussianClass, lnDensity) {
+	SeedBase seedBase(0);
+	Eigen::VectorXd mean;
+	Eigen::MatrixXd cov;
+	Vector<Real> param;
+	testParam(mean, cov, param);
+
+	Matrix<Real> data(4, 3);
+	data << 1., -1., 2.,
+			0.5, 0.2, -3.,
+			4., 1., 1.5,
+			-2., 3., 0.;
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(3, false);
+	ASSERT_EQ(mgc.nParam(), 9);
+	ASSERT_EQ(mgc.setParam(param).size(), 0);
+
+	Vector<Real> logProba;
+	mgc.lnDensity(logProba);
+
+	ASSERT_EQ(logProba.size(), 4);
+	for (Index i = 0; i < 4; ++i) {
+		Eigen::VectorXd x = data.row(i).transpose();
+		Real expected = lnDensityDirect(x, mean, cov);
+		EXPECT_NEAR(logProba(i), expected, 1.e-10);
+		EXPECT_NEAR(mgc.lnDensity(i), expected, 1.e-10);
+	}
+}
+
+/**
+ * The observed density of an individual with missing coordinates is the density of the marginal distribution of its observed coordinates.
+ */
+TEST(MultivariateGaussianClass, lnObservedDensity) {
+	SeedBase seedBase(0);
+	Real nan = std::numeric_limits<Real>::quiet_NaN();
+
+	Eigen::VectorXd mean;
+	Eigen::MatrixXd cov;
+	Vector<Real> param;
+	testParam(mean, cov, param);
+
+	Matrix<Real> data(2, 3);
+	data << 0.5, nan, -3.,
+			1., 2., 3.;
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(3, false);
+	ASSERT_EQ(mgc.setParam(param).size(), 0);
+
+	Eigen::VectorXd xObs(2), meanObs(2);
+	Eigen::MatrixXd covObs(2, 2);
+	xObs << 0.5, -3.;
+	meanObs << mean(0), mean(2);
+	covObs << cov(0, 0), cov(0, 2), cov(2, 0), cov(2, 2);
+
+	EXPECT_NEAR(mgc.lnObservedDensity(patternInd(0), 0), lnDensityDirect(xObs, meanObs, covObs), 1.e-10);
+}
+
+/**
+ * The empirical mean and covariance of the sampled missing coordinates must be close to the moments of the conditional distribution.
+ */
+TEST(MultivariateGaussianClass, sampleMissing) {
+	SeedBase seedBase(0);
+	Real nan = std::numeric_limits<Real>::quiet_NaN();
+	Index nInd = 100000;
+	Real tolerance = 0.02;
+
+	Eigen::VectorXd mean;
+	Eigen::MatrixXd cov;
+	Vector<Real> param;
+	testParam(mean, cov, param);
+
+	Matrix<Real> data(nInd, 3);
+	for (Index i = 0; i < nInd; ++i) {
+		data(i, 0) = nan;
+		data(i, 1) = nan;
+		data(i, 2) = 3.;
+	}
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(3, false);
+	ASSERT_EQ(mgc.setParam(param).size(), 0);
+
+	Index p = patternInd(0);
+	mgc.sampleMissing(p, patterns[p].ind_);
+
+	Eigen::VectorXd expectedMean = mean.head(2) + cov.block(0, 2, 2, 1) * (3. - mean(2)) / cov(2, 2);
+	Eigen::MatrixXd expectedCov = cov.block(0, 0, 2, 2) - cov.block(0, 2, 2, 1) * cov.block(2, 0, 1, 2) / cov(2, 2);
+
+	Eigen::MatrixXd sample = data.leftCols(2);
+	Eigen::VectorXd sampleMean = sample.colwise().mean().transpose();
+	sample.rowwise() -= sampleMean.transpose();
+	Eigen::MatrixXd sampleCov = sample.transpose() * sample / Real(nInd);
+
+	EXPECT_TRUE(sampleMean.isApprox(expectedMean, tolerance));
+	EXPECT_TRUE(sampleCov.isApprox(expectedCov, tolerance));
+	EXPECT_TRUE((data.col(2).array() == 3.).all()); // the observed coordinates are not modified
+}
+
+/**
+ * The parameters estimated by mStep on a large sample must be close to the parameters used to generate it.
+ */
+TEST(MultivariateGaussianClass, mStep) {
+	SeedBase seedBase(0);
+	Index nInd = 100000;
+	Real tolerance = 0.02;
+
+	Eigen::VectorXd mean;
+	Eigen::MatrixXd cov;
+	Vector<Real> param;
+	testParam(mean, cov, param);
+	Eigen::MatrixXd chol = cov.llt().matrixL();
+
+	NormalStatistic normal;
+	Matrix<Real> data(nInd, 3);
+	std::set<Index> setInd;
+	Eigen::VectorXd z(3);
+	for (Index i = 0; i < nInd; ++i) {
+		for (Index j = 0; j < 3; ++j) {
+			z(j) = normal.sample(0., 1.);
+		}
+		data.row(i) = (mean + chol * z).transpose();
+		setInd.insert(i);
+	}
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(3, false);
+	ASSERT_EQ(mgc.checkSampleCondition(setInd).size(), 0);
+	ASSERT_EQ(mgc.mStep(setInd).size(), 0);
+
+	EXPECT_TRUE(Eigen::VectorXd(mgc.mean()).isApprox(mean, tolerance));
+	EXPECT_TRUE(Eigen::MatrixXd(mgc.cov()).isApprox(cov, tolerance));
+}
+
+/**
+ * With a diagonal covariance the density is the product of the univariate densities, and the covariance must be positive definite.
+ */
+TEST(MultivariateGaussianClass, diagonal) {
+	SeedBase seedBase(0);
+	NormalStatistic normal;
+
+	Matrix<Real> data(2, 3);
+	data << 1., -1., 2.,
+			0.5, 0.2, -3.;
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(3, true);
+	ASSERT_EQ(mgc.nParam(), 6);
+
+	Vector<Real> param(6);
+	param << 1., -1., 2., 2., 1.5, 0.5;
+	ASSERT_EQ(mgc.setParam(param).size(), 0);
+
+	Vector<Real> logProba;
+	mgc.lnDensity(logProba);
+	for (Index i = 0; i < 2; ++i) {
+		Real expected = 0.;
+		for (Index j = 0; j < 3; ++j) {
+			expected += normal.lpdf(data(i, j), param(j), std::sqrt(param(3 + j)));
+		}
+		EXPECT_NEAR(logProba(i), expected, 1.e-10);
+	}
+
+	param(4) = -1.;
+	EXPECT_LT(0, mgc.setParam(param).size());
+}
+
+/**
+ * The median of each coefficient of positive definite covariances can form a matrix which is not positive definite. The covariance used
+ * afterward must then be positive definite, and be the exported median, so that it can be used in prediction.
+ */
+TEST(MultivariateGaussianClass, setExpectationParamNotPositiveDefinite) {
+	SeedBase seedBase(0);
+	Matrix<Real> data(2, 2);
+	data << 1., -1.,
+			0.5, 0.2;
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	MultivariateGaussianClass mgc(data, patterns, 0.95);
+	mgc.setSize(2, false);
+
+	Matrix<Real> sampledParam(3, 5); // mean, then cov(0, 0), cov(1, 0), cov(1, 1) of each sample, all positive definite
+	sampledParam << 0., 0., 0.01, 0.9, 100.,
+			0., 0., 100., 0.9, 0.01,
+			0., 0., 0.01, 0., 0.01;
+	for (Index iteration = 0; iteration < 3; ++iteration) {
+		ASSERT_EQ(mgc.setParam(sampledParam.row(iteration).transpose()).size(), 0);
+		mgc.sampleParam(iteration, 2);
+	}
+
+	mgc.setExpectationParam(); // the medians are 0.01, 0.9, 0.01, which is not positive definite
+
+	Eigen::MatrixXd cov = mgc.cov();
+	EXPECT_EQ(cov.llt().info(), Eigen::Success);
+
+	Vector<Real> exported = mgc.paramStat().getStatStorage().col(0);
+	EXPECT_NEAR(exported(2), cov(0, 0), 1.e-12);
+	EXPECT_NEAR(exported(3), cov(1, 0), 1.e-12);
+	EXPECT_NEAR(exported(4), cov(1, 1), 1.e-12);
+
+	MultivariateGaussianClass predictClass(data, patterns, 0.95);
+	predictClass.setSize(2, false);
+	EXPECT_EQ(predictClass.setParam(exported).size(), 0);
+}
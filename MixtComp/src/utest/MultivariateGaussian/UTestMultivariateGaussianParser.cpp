@@ -0,0 +1,95 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Authors:    Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+TEST(MultivariateGaussianParser, basicTest) {
+	std::vector<std::string> dataStr = { "1.5, -2, 3e1", " ? ,4,5 ", "6, ?, ?" };
+
+	Index nDim = 0;
+	Matrix<Real> data;
+	std::string warnLog = parseMultivariateGaussianStr(dataStr, nDim, data);
+
+	ASSERT_EQ(warnLog.size(), 0);
+	ASSERT_EQ(nDim, 3);
+	ASSERT_EQ(data.rows(), 3);
+	ASSERT_EQ(data.cols(), 3);
+
+	EXPECT_EQ(data(0, 0), 1.5);
+	EXPECT_EQ(data(0, 1), -2.);
+	EXPECT_EQ(data(0, 2), 30.);
+	EXPECT_TRUE(std::isnan(data(1, 0)));
+	EXPECT_EQ(data(1, 1), 4.);
+	EXPECT_EQ(data(1, 2), 5.);
+	EXPECT_EQ(data(2, 0), 6.);
+	EXPECT_TRUE(std::isnan(data(2, 1)));
+	EXPECT_TRUE(std::isnan(data(2, 2)));
+}
+
+TEST(MultivariateGaussianParser, errorTest) {
+	Index nDim = 0;
+	Matrix<Real> data;
+	EXPECT_LT(0, parseMultivariateGaussianStr( { "1, 2", "1, 2, 3" }, nDim, data).size()); // inconsistent number of coordinates
+
+	nDim = 0;
+	EXPECT_LT(0, parseMultivariateGaussianStr( { "1, 2", "1, a" }, nDim, data).size()); // not a real number
+
+	nDim = 0;
+	EXPECT_LT(0, parseMultivariateGaussianStr( { "1, 2", "1, 2x" }, nDim, data).size()); // not completely a real number
+
+	nDim = 3;
+	EXPECT_LT(0, parseMultivariateGaussianStr( { "1, 2", "1, 2" }, nDim, data).size()); // nDim provided, and not respected
+}
+
+TEST(MultivariateGaussianParser, missingPatterns) {
+	Real nan = std::numeric_limits<Real>::quiet_NaN();
+	Matrix<Real> data(5, 3);
+	data << 1., nan, 2.,
+			nan, nan, 3.,
+			1., nan, 2.,
+			nan, nan, 3.,
+			nan, nan, nan;
+
+	std::vector<MissingPattern> patterns;
+	Vector<Index> patternInd;
+	computeMissingPatterns(data, patterns, patternInd);
+
+	ASSERT_EQ(patterns.size(), 4); // the complete pattern is present even though no individual is complete
+	EXPECT_EQ(patterns[0].mis_.size(), 0);
+	EXPECT_EQ(patterns[0].obs_.size(), 3);
+	EXPECT_EQ(patterns[0].ind_.size(), 0);
+
+	EXPECT_EQ(patternInd(0), patternInd(2));
+	EXPECT_EQ(patternInd(1), patternInd(3));
+	EXPECT_NE(patternInd(0), patternInd(1));
+
+	const MissingPattern& pattern = patterns[patternInd(1)];
+	EXPECT_EQ(pattern.mis_, std::vector<Index>( { 0, 1 }));
+	EXPECT_EQ(pattern.obs_, std::vector<Index>( { 2 }));
+	EXPECT_EQ(pattern.ind_, std::vector<Index>( { 1, 3 }));
+
+	EXPECT_EQ(patterns[patternInd(4)].obs_.size(), 0);
+}
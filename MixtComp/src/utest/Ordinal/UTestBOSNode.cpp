@@ -0,0 +1,103 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: March 24, 2015
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+/**
+ * Computation of a partition
+ */
+TEST(BOSNode, partition0) {
+	Vector<int, 2> e;
+	e << 0, 5;
+	BOSNode node;
+	node.y_ = 2;
+
+	node.partition(e);
+	ASSERT_EQ(node.partSize_, 3);
+	ASSERT_EQ(node.part_(0), (Vector<int, 2>() << 0, 1).finished());
+	ASSERT_EQ(node.part_(1), (Vector<int, 2>() << 2, 2).finished());
+	ASSERT_EQ(node.part_(2), (Vector<int, 2>() << 3, 5).finished());
+}
+
+/**
+ * Computation of a partition, when y is outside of the segment
+ */
+TEST(BOSNode, partition1) {
+	Vector<int, 2> e;
+	e << 6, 8;
+	BOSNode node;
+	node.y_ = 2;
+
+	node.partition(e);
+	ASSERT_EQ(node.partSize_, 0);
+}
+
+/**
+ * Computation of a partition, when the left segment is empty
+ */
+TEST(BOSNode, partition2) {
+	Vector<int, 2> e;
+	e << 6, 8;
+	BOSNode node;
+	node.y_ = 6;
+
+	node.partition(e);
+	ASSERT_EQ(node.partSize_, 2);
+	ASSERT_EQ(node.part_(0), (Vector<int, 2>() << 6, 6).finished());
+	ASSERT_EQ(node.part_(1), (Vector<int, 2>() << 7, 8).finished());
+}
+
+/**
+ * Computation of a partition, when the right segment is empty
+ */
+TEST(BOSNode, partition3) {
+	Vector<int, 2> e;
+	e << 6, 8;
+	BOSNode node;
+	node.y_ = 8;
+
+	node.partition(e);
+	ASSERT_EQ(node.partSize_, 2);
+	ASSERT_EQ(node.part_(0), (Vector<int, 2>() << 6, 7).finished());
+	ASSERT_EQ(node.part_(1), (Vector<int, 2>() << 8, 8).finished());
+}
+
+/**
+ * The closest segment to the mode is the one containing it, or the first / last one if the mode is outside of the partition
+ */
+TEST(BOSNode, closestPart) {
+	Vector<int, 2> e;
+	e << 2, 7;
+	BOSNode node;
+	node.y_ = 4;
+	node.partition(e);
+
+	ASSERT_EQ(node.closestPart(0), 0);
+	ASSERT_EQ(node.closestPart(3), 0);
+	ASSERT_EQ(node.closestPart(4), 1);
+	ASSERT_EQ(node.closestPart(6), 2);
+	ASSERT_EQ(node.closestPart(9), 2);
+}
@@ -0,0 +1,188 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: March 24, 2015
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+/**
+ * Simple case with two modalities
+ */
+TEST(BOSPath, computeLogProba0) {
+	SeedBase seedBase(0);
+	int mu = 1; // mode
+	Real pi = 0.5; // precision
+
+	BOSPath path;
+	path.setInit(0, 1);
+	path.setEnd(0, 1);
+
+	Vector<int, 2> eInit;
+	eInit << 0, 1;
+
+	Vector<BOSNode> c(1);
+	c(0).y_ = 1; // second element y picked, proba 0.5
+	c(0).z_ = 1; // comparison is perfect, proba 0.5
+	c(0).partition(eInit); // computation of the partition
+	c(0).e_ << 1, 1; // segment is {1}, proba 1.
+
+	path.setC(c);
+
+	Real expectedProba = std::log(0.5 * 0.5 * 1.);
+	Real computedProba = path.computeLogProba(mu, pi);
+
+	ASSERT_LT(std::abs(expectedProba - computedProba), epsilon);
+}
+
+/**
+ * Simple case with three modalities and imprecision
+ */
+TEST(BOSPath, computeLogProba1) {
+	SeedBase seedBase(0);
+	int mu = 1; // mode
+	Real pi = 0.5; // precision
+
+	BOSPath path;
+	path.setInit(0, 2);
+	path.setEnd(0, 0);
+
+	Vector<int, 2> eInit;
+	eInit << 0, 2;
+
+	Vector<BOSNode> c(2);
+
+	c(0).y_ = 1; // y, middle element y picked, proba 1./3.
+	c(0).z_ = 0; // z, comparison is imperfect, proba 0.5
+	c(0).partition(eInit); // computation of the partition
+	c(0).e_ << 0, 0; // e, left segment {0, 0} selected, proba 0.33 (all have the same size)
+
+	c(1).y_ = 0; // y, only one element to choose from, proba 1.
+	c(1).z_ = 1; // z, comparison is perfect, proba 0.5
+	c(1).partition(c(0).e_); // computation of the partition
+	c(1).e_ << 0, 0; // e, only one segment in partition, with proba 1.
+
+	path.setC(c);
+
+	Real expectedProba = std::log(1. / 3. * 0.5 * 1. / 3. * 1. * 0.5 * 1.);
+	Real computedProba = path.computeLogProba(mu, pi);
+
+	ASSERT_LT(std::abs(expectedProba - computedProba), epsilon);
+}
+
+/**
+ * The constant time computation from the cached statistics must match the node by node computation, for every mode
+ */
+TEST(BOSPath, computeLogProbaTable) {
+	SeedBase seedBase(0);
+	int nbModality = 6;
+	Real pi = 0.4;
+	int nbPath = 100;
+
+	BOSPath path;
+	path.setInit(0, nbModality - 1);
+	path.setEnd(0, nbModality - 1);
+
+	BOSTable table;
+
+	for (int p = 0; p < nbPath; ++p) {
+		path.forwardSamplePath(p % nbModality, pi);
+
+		for (int mu = 0; mu < nbModality; ++mu) {
+			table.compute(nbModality, mu, pi);
+			Real expectedProba = path.computeLogProba(mu, pi);
+			Real computedProba = path.computeLogProba(table);
+
+			if (expectedProba == minInf) {
+				ASSERT_EQ(computedProba, minInf);
+			} else {
+				ASSERT_NEAR(expectedProba, computedProba, epsilon);
+			}
+		}
+	}
+}
+
+/**
+ * The frequencies of the values obtained by forwardSamplePath must match the probabilities in the table
+ */
+TEST(BOSPath, forwardSamplePath) {
+	SeedBase seedBase(0);
+	int nbModality = 5;
+	int mu = 3;
+	Real pi = 0.4;
+	int nbIter = 10000;
+
+	BOSTable table;
+	table.compute(nbModality, mu, pi);
+
+	BOSPath path;
+	path.setInit(0, nbModality - 1);
+	path.setEnd(0, nbModality - 1);
+
+	Vector<Real> computedProba(nbModality, 0.);
+	for (int iter = 0; iter < nbIter; ++iter) {
+		path.forwardSamplePath(mu, pi);
+		computedProba(path.x()) += 1.;
+	}
+	computedProba /= computedProba.sum();
+
+	for (int x = 0; x < nbModality; ++x) {
+		ASSERT_NEAR(computedProba(x), table.proba(0, nbModality - 1, x), 0.02);
+	}
+}
+
+/**
+ * Paths sampled by samplePath must verify the end condition, and the frequencies of their values must match the probabilities in the
+ * table, conditionally to the end condition
+ */
+TEST(BOSPath, samplePath) {
+	SeedBase seedBase(0);
+	int nbModality = 5;
+	int mu = 0;
+	Real pi = 0.6;
+	int nbIter = 10000;
+	int endMin = 2;
+	int endMax = 4;
+
+	BOSTable table;
+	table.compute(nbModality, mu, pi);
+
+	BOSPath path;
+	path.setInit(0, nbModality - 1);
+	path.setEnd(endMin, endMax);
+
+	Vector<Real> computedProba(nbModality, 0.);
+	for (int iter = 0; iter < nbIter; ++iter) {
+		path.samplePath(table);
+		ASSERT_LE(endMin, path.x());
+		ASSERT_LE(path.x(), endMax);
+		ASSERT_GT(path.computeLogProba(table), minInf);
+		computedProba(path.x()) += 1.;
+	}
+	computedProba /= computedProba.sum();
+
+	Real condProba = table.probaInterval(0, nbModality - 1, endMin, endMax);
+	for (int x = endMin; x < endMax + 1; ++x) {
+		ASSERT_NEAR(computedProba(x), table.proba(0, nbModality - 1, x) / condProba, 0.02);
+	}
+}
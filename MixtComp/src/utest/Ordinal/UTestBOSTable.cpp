@@ -0,0 +1,96 @@
+/* MixtComp version 4  - july 2019
+ * Copyright (C) Inria - Université de Lille - CNRS*/
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>
+ **/
+
+
+/*
+ *  Project:    MixtComp
+ *  Created on: October 18, 2026
+ *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
+ **/
+
+#include "gtest/gtest.h"
+#include "MixtComp.h"
+
+using namespace mixt;
+
+/**
+ * The distribution of the final value of a search process at any segment must sum to 1, and be null outside of the segment
+ */
+TEST(BOSTable, normalization) {
+	int nbModality = 6;
+	BOSTable table;
+	table.compute(nbModality, 2, 0.3);
+
+	for (int a = 0; a < nbModality; ++a) {
+		for (int b = a; b < nbModality; ++b) {
+			Real sum = 0.;
+			for (int x = 0; x < nbModality; ++x) {
+				if (x < a || b < x) {
+					ASSERT_EQ(table.proba(a, b, x), 0.);
+				}
+				sum += table.proba(a, b, x);
+			}
+			ASSERT_NEAR(sum, 1., epsilon);
+		}
+	}
+}
+
+/**
+ * With only blind comparisons, the final value is uniformly distributed
+ */
+TEST(BOSTable, nullPrecision) {
+	int nbModality = 5;
+	BOSTable table;
+	table.compute(nbModality, 1, 0.);
+
+	for (int x = 0; x < nbModality; ++x) {
+		ASSERT_NEAR(table.proba(0, nbModality - 1, x), 1. / nbModality, epsilon);
+	}
+}
+
+/**
+ * With a positive precision, the mode of the distribution is mu
+ */
+TEST(BOSTable, mode) {
+	int nbModality = 5;
+	BOSTable table;
+
+	for (int mu = 0; mu < nbModality; ++mu) {
+		table.compute(nbModality, mu, 0.5);
+
+		Vector<Real> proba(nbModality);
+		for (int x = 0; x < nbModality; ++x) {
+			proba(x) = table.proba(0, nbModality - 1, x);
+		}
+
+		int computedMode;
+		proba.maxCoeff(&computedMode);
+		ASSERT_EQ(computedMode, mu);
+	}
+}
+
+/**
+ * Probability of an interval and observed probability
+ */
+TEST(BOSTable, probaInterval) {
+	int nbModality = 5;
+	BOSTable table;
+	table.compute(nbModality, 3, 0.6);
+
+	ASSERT_NEAR(table.probaInterval(1, 4, 2, 3), table.proba(1, 4, 2) + table.proba(1, 4, 3), epsilon);
+	ASSERT_NEAR(table.probaInterval(0, 4, 0, 4), 1., epsilon);
+	ASSERT_NEAR(table.lnObservedProbability(1, 1), std::log(table.proba(0, 4, 1)), epsilon);
+}
@@ -254,3 +254,10 @@ TEST(RankClass, lnObservedProbability) {
 
 	ASSERT_EQ(rc.lnObservedProbability(0), 0.);
 }
+
+TEST(RankClass, isExactObservedProbaCheaper) {
+	ASSERT_TRUE(RankClass::isExactObservedProbaCheaper(8, 1000000)); // cheaper than the minimum number of importance samples
+	ASSERT_TRUE(RankClass::isExactObservedProbaCheaper(14, 1)); // cheaper than sampling the observed distribution of a class
+	ASSERT_FALSE(RankClass::isExactObservedProbaCheaper(14, 100));
+	ASSERT_FALSE(RankClass::isExactObservedProbaCheaper(maxNbPosExactRank + 1, 1));
+}
@@ -199,40 +199,136 @@ TEST(RankIndividual, lnCompletedProbability) {
 	ASSERT_EQ(sameProba, Vector<bool>(nbSample, true));
 }
 
-/** Estimate the observed probability distribution using independent samples. Compare the mode to the real
- * parameter. */
-TEST(RankIndividual, observedProba) {
-	int nbPos = 6;
-	RankVal mu = { 5, 1, 0, 4, 2, 3 };
-	Real pi = 0.87;
+/** Reference computation of A and G, by explicitly performing the insertion sort of the presentation order */
+void naiveAG(const RankVal& x, const Vector<int>& y, const RankVal& mu, int& a, int& g) {
+	a = 0;
+	g = 0;
+
+	std::vector<int> sorted(1, y(0));
+	for (int j = 1; j < y.size(); ++j) {
+		int currY = y(j);
+		bool yPlaced = false;
+		for (int i = 0; i < j; ++i) {
+			yPlaced = (x.r()(currY) < x.r()(sorted[i]));
+			++a;
+			if (yPlaced == (mu.r()(currY) < mu.r()(sorted[i]))) {
+				++g;
+			}
+			if (yPlaced) {
+				sorted.insert(sorted.begin() + i, currY);
+				break;
+			}
+		}
+		if (!yPlaced) {
+			sorted.push_back(currY);
+		}
+	}
+}
 
-	RankIndividual rv(nbPos);
+/** Compare AG to the explicit insertion sort, for all completed values and several presentation orders and central ranks */
+TEST(RankIndividual, AG) {
+	SeedBase seedBase(0);
+	int nbPos = 5;
+	int nbPerm = 120;
+	int nbSample = 10;
+
+	RankIndividual rank(nbPos);
 	Vector<MisVal> obsData(nbPos, MisVal(missing_, { }));
-	rv.setObsData(obsData);
-	rv.removeMissing();
+	rank.setObsData(obsData);
 
-	std::map<RankVal, Real> proba;
+	RankVal mu(nbPos);
+	int a, g, aRef, gRef;
+	bool same = true;
+
+	for (int s = 0; s < nbSample; ++s) {
+		rank.removeMissing(); // new presentation order
+		mu.setCode((s * 37) % nbPerm);
+		for (int c = 0; c < nbPerm; ++c) {
+			rank.xModif().setCode(c);
+			rank.AG(mu, a, g);
+			naiveAG(rank.x(), rank.y(), mu, aRef, gRef);
+			if (a != aRef || g != gRef) {
+				same = false;
+			}
+		}
+	}
 
-	rv.observedProba(mu, pi, proba);
+	ASSERT_TRUE(same);
+}
 
-	RankVal muEst = proba.begin()->first;
-	Real probaEst = proba.begin()->second;
+/** Compare deltaG to the difference of g computed by AG before and after each permutation of mu */
+TEST(RankIndividual, deltaG) {
+	SeedBase seedBase(0);
+	int nbPos = 5;
+	int nbPerm = 120;
+	int nbSample = 10;
 
-	for (std::map<RankVal, Real>::const_iterator it = proba.begin(), itEnd = proba.end(); it != itEnd; ++it) {
-#ifdef MC_DEBUG
-		std::cout << "RankVal: " << it->first << ", proba: " << it->second << std::endl;
-#endif
-		if (probaEst < it->second) { // comparison to current mode
-			muEst = it->first;
-			probaEst = it->second;
+	RankIndividual rank(nbPos);
+	Vector<MisVal> obsData(nbPos, MisVal(missing_, { }));
+	rank.setObsData(obsData);
+
+	RankVal mu(nbPos);
+	int a, g, aPerm, gPerm;
+	bool same = true;
+
+	for (int s = 0; s < nbSample; ++s) {
+		rank.removeMissing();
+		rank.xModif().setCode((s * 53) % nbPerm);
+		for (int c = 0; c < nbPerm; ++c) {
+			mu.setCode(c);
+			rank.AG(mu, a, g);
+			for (int p = 0; p < nbPos - 1; ++p) {
+				int dG = rank.deltaG(mu, p);
+				mu.permutation(p);
+				rank.AG(mu, aPerm, gPerm);
+				mu.permutation(p);
+				if (aPerm != a || gPerm - g != dG) {
+					same = false;
+				}
+			}
 		}
 	}
 
-#ifdef MC_DEBUG
-	std::cout << "muEst: " << muEst << ", probaEst: " << probaEst << std::endl;
-#endif
+	ASSERT_TRUE(same);
+}
+
+/** The exact marginal probabilities of all the completed values must sum to one, and the estimated ones must be close to
+ * the exact ones */
+TEST(RankIndividual, lnMarginalProbability) {
+	SeedBase seedBase(0);
+	int nbPos = 5;
+	int nbPerm = 120;
+	Real pi = 0.7;
+	Real tolerance = 1e-8;
+	Real relError = 0.01;
+
+	Vector<int> muVec(nbPos);
+	muVec << 3, 0, 4, 1, 2;
+	RankVal mu(nbPos);
+	mu.setO(muVec);
+
+	RankIndividual rank(nbPos);
+	Vector<MisVal> obsData(nbPos, MisVal(missing_, { }));
+	rank.setObsData(obsData);
+	rank.removeMissing();
+
+	Real sumProba = 0.;
+	bool sameProba = true;
+	for (int c = 0; c < nbPerm; ++c) {
+		rank.xModif().setCode(c);
+		Real exact = rank.lnMarginalProbability(mu, pi);
+		sumProba += std::exp(exact);
+
+		if (c % 10 == 0) {
+			Real sampled = rank.lnMarginalProbability(mu, pi, relError, 100 * nbSampleObserved);
+			if (5. * relError < std::abs(std::exp(sampled - exact) - 1.)) {
+				sameProba = false;
+			}
+		}
+	}
 
-	ASSERT_EQ(mu, muEst);
+	ASSERT_LT(std::abs(sumProba - 1.), tolerance);
+	ASSERT_TRUE(sameProba);
 }
 
 TEST(RankIndividual, checkAcceptedTypeTrue) {
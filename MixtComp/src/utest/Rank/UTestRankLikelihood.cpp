@@ -68,3 +68,21 @@ TEST(RankLikelihood, basicTest)
 
   ASSERT_EQ(computedMat.isApprox(expectedMat), true);
 }
+
+/** Observations of log-likelihoods that would underflow if exponentiated */
+TEST(RankLikelihood, logTest)
+{
+  RankLikelihood rl;
+  rl.init(1, 1, 3);
+
+  rl.observeLog(0, 0, -1000.);
+  rl.observeLog(0, 0, -1001.);
+  rl.observeLog(0, 0, -1002.);
+
+  Matrix<Real> computedMat;
+  rl.getHMean(computedMat);
+
+  Real expected = -1000. - std::log(1. / 3. * (1. + std::exp(1.) + std::exp(2.)));
+
+  ASSERT_NEAR(expected, computedMat(0, 0), 1e-10);
+}
@@ -64,3 +64,23 @@ TEST(RankParser, minMaxDetection) {
 
 	ASSERT_GT(resStr.size(), 0);
 }
+
+/** Individuals with the same observed data share their completions, which are enumerated only once. */
+TEST(RankParser, sharedCompleted) {
+	SeedBase seedBase(0);
+	int nbPos;
+	std::vector<std::string> vecStr = { "0 , ? , ? , 3", "0 , ? , ? , 3", "1 , ? , ? , 3" };
+
+	Vector<RankIndividual> vecInd;
+
+	std::string resStr = parseRankStr(vecStr, 0, nbPos, vecInd);
+
+	ASSERT_EQ(0, resStr.size());
+	ASSERT_EQ(2, vecInd(0).completed().size());
+	ASSERT_EQ(vecInd(0).completedPtr(), vecInd(1).completedPtr());
+	ASSERT_NE(vecInd(0).completedPtr(), vecInd(2).completedPtr());
+
+	RankVal rv(nbPos);
+	rv.setCode(vecInd(2).completed()[1]); // completions are sorted in lexicographic order
+	ASSERT_EQ(RankVal({ 1, 2, 0, 3 }), rv);
+}
@@ -68,3 +68,44 @@ TEST(RankVal, permutation)
 
   ASSERT_EQ(res, Vector<bool>(nbSample, true));
 }
+
+/** The Lehmer code enumerates the permutations in lexicographic order. */
+TEST(RankVal, code)
+{
+  int nbPos = 4;
+  RankVal rv(nbPos);
+
+  std::vector<int> ordering = {0, 1, 2, 3};
+  Index expectedCode = 0;
+  do
+  {
+    rv.setO(ordering);
+    ASSERT_EQ(expectedCode, rv.code());
+
+    RankVal rvDecoded(nbPos);
+    rvDecoded.setCode(expectedCode);
+    ASSERT_EQ(rv, rvDecoded);
+    ++expectedCode;
+  }
+  while (std::next_permutation(ordering.begin(), ordering.end()));
+
+  ASSERT_EQ(24, expectedCode);
+
+  RankVal rvLast = {19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}; // largest code, 20! - 1
+  ASSERT_EQ(2432902008176639999ul, rvLast.code());
+}
+
+/** The representations are stored inline, a copy must nonetheless be independent from the original */
+TEST(RankVal, copy)
+{
+  RankVal rv = {19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  RankVal rvCopy;
+  rvCopy = rv;
+  ASSERT_EQ(rv, rvCopy);
+
+  rvCopy.permutation(0);
+  ASSERT_EQ(18, rvCopy.o()(0));
+  ASSERT_EQ(0, rvCopy.r()(18));
+  ASSERT_EQ(19, rv.o()(0));
+  ASSERT_TRUE(rvCopy < rv);
+}
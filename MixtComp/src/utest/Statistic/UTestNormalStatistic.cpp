@@ -321,3 +321,42 @@ TEST(NormalStatistic, sampleIB) {
 	ASSERT_NEAR(expectedMu, computedMu, 0.01);
 	ASSERT_NEAR(expectedSigma, computedSigma, 0.01);
 }
+
+TEST(NormalStatistic, sampleIBatch) {
+	SeedBase seedBase(0);
+	Real mu = 12.;
+	Real sigma = 5.;
+
+	Real a = 6.;
+	Real b = 9.;
+
+	Index nSample = 50000;
+	Real expectedMu, expectedSigma, computedMu, computedSigma;
+
+	NormalStatistic normal;
+	Vector<Real> sampleVal;
+
+	normal.sampleI(Vector<Real>(nSample, mu), Vector<Real>(nSample, sigma), Vector<Real>(nSample, a), Vector<Real>(nSample, b), sampleVal);
+
+	normal.expSigmaTruncated(mu, sigma, a, b, expectedMu, expectedSigma);
+
+	meanSD(sampleVal, computedMu, computedSigma);
+
+	ASSERT_NEAR(expectedMu, computedMu, 0.01);
+	ASSERT_NEAR(expectedSigma, computedSigma, 0.01);
+
+	Real inf = std::numeric_limits<Real>::infinity();
+	Vector<Real> mean(5, 0.);
+	Vector<Real> sd(5, 1.);
+	Vector<Real> infBound(5);
+	Vector<Real> supBound(5);
+	infBound << -1., 50., -inf, 3., -inf; // straddling, far tail handled by the rejection samplers, upper bound, lower bound, unbounded
+	supBound << 0.5, 51., -2., inf, inf;
+
+	normal.sampleI(mean, sd, infBound, supBound, sampleVal);
+
+	for (Index i = 0; i < 5; ++i) {
+		ASSERT_LE(infBound(i), sampleVal(i));
+		ASSERT_LE(sampleVal(i), supBound(i));
+	}
+}
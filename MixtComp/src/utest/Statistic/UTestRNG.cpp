@@ -20,6 +20,8 @@
  *  Author:     Vincent KUBICKI <vincent.kubicki@inria.fr>
  **/
 
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "MixtComp.h"
 
@@ -31,3 +33,31 @@ using namespace mixt;
 TEST(RNG, deterministicMode) {
 	ASSERT_EQ(true, deterministicMode());
 }
+
+/**
+ * The generators created while a SeedBase exists only depend on its base, and not on the thread.
+ */
+TEST(RNG, seedBase) {
+	Index nSample = 5;
+	Vector<Real> first(nSample);
+	Vector<Real> second(nSample);
+
+	{
+		SeedBase seedBase(12);
+		NormalStatistic normal;
+		for (Index i = 0; i < nSample; ++i) {
+			first(i) = normal.sample(0., 1.);
+		}
+	}
+
+	std::thread other([&]() {
+		SeedBase seedBase(12);
+		NormalStatistic normal;
+		for (Index i = 0; i < nSample; ++i) {
+			second(i) = normal.sample(0., 1.);
+		}
+	});
+	other.join();
+
+	ASSERT_EQ(first, second);
+}
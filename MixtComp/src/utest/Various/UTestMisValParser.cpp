@@ -171,3 +171,29 @@ TEST(MisValParser, simpleValueEng)
 
   ASSERT_EQ(val, str2type<Real>("8.40405864500071e-05"));
 }
+
+TEST(NumericToAugmentedData, indexWithOffset) {
+	SeedBase seedBase(0);
+	Vector<Real> data(4);
+	data << 1., 3., std::numeric_limits<Real>::quiet_NaN(), 2.;
+
+	AugmentedData<Vector<Index> > augData;
+	std::string warnLog = NumericToAugmentedData("categ", data, augData, -minModality);
+
+	ASSERT_EQ(0, warnLog.size());
+	ASSERT_EQ(0, augData.data_(0));
+	ASSERT_EQ(2, augData.data_(1));
+	ASSERT_EQ(missing_, augData.misData_(2).first);
+	ASSERT_EQ(present_, augData.misData_(3).first);
+}
+
+TEST(NumericToAugmentedData, nonIntegerValue) {
+	SeedBase seedBase(0);
+	Vector<Real> data(2);
+	data << 1., 2.5;
+
+	AugmentedData<Vector<Index> > augData;
+	std::string warnLog = NumericToAugmentedData("categ", data, augData, 0);
+
+	ASSERT_LT(0, warnLog.size());
+}
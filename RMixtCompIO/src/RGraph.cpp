@@ -33,32 +33,38 @@ void RGraph::set(const Rcpp::List& j) {
 }
 
 void RGraph::getSubGraph(const std::vector<std::string>& path, RGraph& j) const {
-	Rcpp::List l;
+	SEXP l;
 	go_to(path, l);
 
-	j.set(l);
+	j.set(Rcpp::List(l));
 }
 
 bool RGraph::exist_payload(const std::vector<std::string>& path, const std::string& name) const {
-	Rcpp::List l;
+	SEXP l;
 	go_to(path, l);
 
-	if (!l.containsElementNamed(name.c_str())) {
+	SEXP elem;
+	return findElement(l, name, elem);
+}
+
+bool RGraph::is_numeric_payload(const std::vector<std::string>& path, const std::string& name) const {
+	SEXP l;
+	go_to(path, l);
+
+	SEXP elem;
+	if (!findElement(l, name, elem)) {
 		return false;
 	}
 
-	return true;
+	return (TYPEOF(elem) == REALSXP || TYPEOF(elem) == INTSXP) && !Rf_isFactor(elem);
 }
 
-void RGraph::go_to(const std::vector<std::string>& path, Rcpp::List& l) const {
-	go_to(path, 0, l_, l);
-}
+void RGraph::go_to(const std::vector<std::string>& path, SEXP& l) const {
+	l = l_;
 
-void RGraph::go_to(const std::vector<std::string>& path, Index currDepth, const Rcpp::List& currLevel, Rcpp::List& l) const {
-	if (currDepth == path.size()) {
-		l = currLevel;
-	} else {
-		if (!currLevel.containsElementNamed(path[currDepth].c_str())) {
+	for (Index currDepth = 0; currDepth < path.size(); ++currDepth) {
+		SEXP nextLevel;
+		if (!findElement(l, path[currDepth], nextLevel)) {
 			std::string askedPath;
 			for (Index i = 0; i < currDepth + 1; ++i) {
 				askedPath += +"/" + path[i];
@@ -66,16 +72,43 @@ void RGraph::go_to(const std::vector<std::string>& path, Index currDepth, const
 			throw(askedPath + " path does not exist.");
 		}
 
-		go_to(path, currDepth + 1, currLevel[path[currDepth]], l);
+		l = nextLevel;
+	}
+}
+
+bool RGraph::findElement(SEXP list, const std::string& name, SEXP& elem) {
+	if (TYPEOF(list) != VECSXP) {
+		return false;
+	}
+
+	SEXP names = Rf_getAttrib(list, R_NamesSymbol);
+	if (Rf_isNull(names)) {
+		return false;
+	}
+
+	R_xlen_t n = Rf_xlength(list);
+	for (R_xlen_t i = 0; i < n; ++i) {
+		if (name == CHAR(STRING_ELT(names, i))) {
+			elem = VECTOR_ELT(list, i);
+			return true;
+		}
 	}
+
+	return false;
 }
 
 void RGraph::name_payload(const std::vector<std::string>& path, std::list<std::string>& l) const {
-	Rcpp::List j;
+	SEXP j;
 	go_to(path, j);
 
-	std::vector<std::string> v = j.names();
-	std::copy(v.begin(), v.end(), std::back_inserter(l));
+	SEXP names = Rf_getAttrib(j, R_NamesSymbol);
+	if (Rf_isNull(names)) {
+		return;
+	}
+
+	for (R_xlen_t i = 0, n = Rf_xlength(names); i < n; ++i) {
+		l.push_back(CHAR(STRING_ELT(names, i)));
+	}
 }
 
 void RGraph::addSubGraph(const std::vector<std::string>& path, const std::string& name, const RGraph& p) {
@@ -69,15 +69,16 @@ public:
 	 */
 	template<typename Type>
 	void get_payload(const std::vector<std::string>& path, const std::string& name, Type& p) const {
-		Rcpp::List l;
+		SEXP l;
 		go_to(path, l);
 
-		if (!l.containsElementNamed(name.c_str())) {
+		SEXP elem;
+		if (!findElement(l, name, elem)) {
 			std::string cPath;
 			completePath(path, name, cPath);
 			throw(cPath + " object does not exist.");
 		}
-		translateRToCPP(l[name], p);
+		translateRToCPP(elem, p);
 	}
 
 	/**
@@ -92,12 +93,26 @@ public:
 
 	bool exist_payload(const std::vector<std::string>& path, const std::string& name) const;
 
+	/**
+	 * Check if the payload is a numeric or integer vector (factors excluded), in which case it can be read as a Vector<Real>
+	 * directly from R memory instead of as a vector of strings. NA correspond to missing values.
+	 */
+	bool is_numeric_payload(const std::vector<std::string>& path, const std::string& name) const;
+
 	void name_payload(const std::vector<std::string>& path, std::list<std::string>& l) const;
 
 private:
-	void go_to(const std::vector<std::string>& path, Rcpp::List& l) const;
+	/**
+	 * The returned SEXP is an element of l_, and is therefore protected as long as l_ is. No Rcpp::List is created
+	 * along the path.
+	 */
+	void go_to(const std::vector<std::string>& path, SEXP& l) const;
 
-	void go_to(const std::vector<std::string>& path, Index currDepth, const Rcpp::List& currLevel, Rcpp::List& l) const;
+	/**
+	 * Look for an element by name in a single pass over the names of the list.
+	 * @return true if the element has been found
+	 */
+	static bool findElement(SEXP list, const std::string& name, SEXP& elem);
 
 	/**
 	 * Note that currLevel is a value and not a reference. This is different from what occurs in JSONGraph for example. The reason is detailed
@@ -42,12 +42,12 @@ void translateCPPToR(const InType& in, SEXP& out) {
 
 template<typename T>
 void translateCPPToR(const NamedVector<T>& in, SEXP& out) {
-	Index nrow = in.vec_.size();
-	typename CPPToRVectorType<T>::ctype temp(nrow);
+	typedef typename CPPToRVectorType<T>::ctype RType;
+	typedef typename RType::stored_type RScalar;
 
-	for (Index i = 0; i < nrow; ++i) {
-		temp[i] = in.vec_(i);
-	}
+	Index nrow = in.vec_.size();
+	RType temp(Rcpp::no_init(nrow));
+	Eigen::Map<Eigen::Matrix<RScalar, Eigen::Dynamic, 1>>(temp.begin(), nrow) = in.vec_.template cast<RScalar>(); // written directly in R memory
 
 	if (in.rowNames_.size() != 0) {
 		temp.attr("names") = in.rowNames_;
@@ -58,16 +58,14 @@ void translateCPPToR(const NamedVector<T>& in, SEXP& out) {
 
 template<typename T>
 void translateCPPToR(const NamedMatrix<T>& in, SEXP& out) {
+	typedef typename CPPToRMatrixType<T>::ctype RType;
+	typedef typename RType::stored_type RScalar;
+
 	Index nrow = in.mat_.rows();
 	Index ncol = in.mat_.cols();
 
-	typename CPPToRMatrixType<T>::ctype temp(nrow, ncol);
-
-	for (Index i = 0; i < nrow; ++i) {
-		for (Index j = 0; j < ncol; ++j) {
-			temp(i, j) = in.mat_(i, j);
-		}
-	}
+	RType temp(Rcpp::no_init(nrow, ncol));
+	Eigen::Map<Eigen::Matrix<RScalar, Eigen::Dynamic, Eigen::Dynamic>>(temp.begin(), nrow, ncol) = in.mat_.template cast<RScalar>(); // written directly in R memory, both storages are column-major
 
 	if (in.rowNames_.size() != 0) {
 		Rcpp::CharacterVector tempName(nrow);
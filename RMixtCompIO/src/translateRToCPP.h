@@ -26,6 +26,7 @@
 #include "Rcpp.h"
 
 #include <iostream>
+#include <limits>
 #include <LinAlg/LinAlg.h>
 #include <LinAlg/names.h>
 #include <IO/NamedAlgebra.h>
@@ -40,48 +41,83 @@ void translateRToCPP(SEXP in, OutType& out) {
 	out = Rcpp::as<OutType>(in);
 }
 
-template<typename T>
-void translateRToCPP(SEXP in, NamedVector<T>& out) {
-	typename CPPToRVectorType<T>::ctype temp(in);
+/**
+ * Copy the content of an R numeric or integer vector / matrix into an Eigen object, through an Eigen::Map over the R memory. The copy is
+ * performed in a single vectorized pass, and the cast is a no-op when the storage types match (NumericVector to Real for example).
+ * Both R and Eigen use column-major storage. NA integers are translated to nan when the destination is a floating point type.
+ */
+template<typename EigenType>
+void mapRToCPP(SEXP in, Index nrow, Index ncol, EigenType& out) {
+	typedef typename EigenType::Scalar Scalar;
+	typedef Eigen::Matrix<double, EigenType::RowsAtCompileTime, EigenType::ColsAtCompileTime> RealMap;
+	typedef Eigen::Matrix<int, EigenType::RowsAtCompileTime, EigenType::ColsAtCompileTime> IntMap;
+
+	out.resize(nrow, ncol);
+
+	switch (TYPEOF(in)) {
+	case REALSXP: {
+		out = Eigen::Map<const RealMap>(REAL(in), nrow, ncol).template cast<Scalar>();
+	}
+		break;
+
+	case INTSXP:
+	case LGLSXP: {
+		const int* rawData = (TYPEOF(in) == INTSXP) ? INTEGER(in) : LOGICAL(in);
+		out = Eigen::Map<const IntMap>(rawData, nrow, ncol).template cast<Scalar>();
+
+		if (std::numeric_limits<Scalar>::has_quiet_NaN) {
+			for (Index i = 0, n = nrow * ncol; i < n; ++i) {
+				if (rawData[i] == NA_INTEGER) {
+					out.data()[i] = std::numeric_limits<Scalar>::quiet_NaN();
+				}
+			}
+		}
+	}
+		break;
 
-	Index nrow = temp.length();
-	out.vec_.resize(nrow);
+	default: {
+		throw(std::string("A numeric or integer R object was expected."));
+	}
+		break;
+	}
+}
+
+/**
+ * Used for numeric data columns.
+ */
+template<typename T>
+void translateRToCPP(SEXP in, Vector<T>& out) {
+	mapRToCPP(in, Rf_xlength(in), 1, out);
+}
 
-	std::vector<std::string> namesVec;
-	SEXP namesR = temp.attr("names");
+template<typename T>
+void translateRToCPP(SEXP in, NamedVector<T>& out) {
+	mapRToCPP(in, Rf_xlength(in), 1, out.vec_);
 
+	SEXP namesR = Rf_getAttrib(in, R_NamesSymbol);
 	if (!Rf_isNull(namesR)) {
 		out.rowNames_ = Rcpp::as<std::vector<std::string>>(namesR);
 	}
-
-	for (Index i = 0; i < nrow; ++i) {
-		out.vec_(i) = temp(i);
-	}
 }
 
 template<typename T>
 void translateRToCPP(SEXP in, NamedMatrix<T>& out) {
-	typename CPPToRMatrixType<T>::ctype temp(in);
-
-	Index nrow = temp.rows();
-	Index ncol = temp.cols();
-	out.mat_.resize(nrow, ncol);
-
-	std::vector<std::string> namesRowVec;
-	SEXP namesRowR = rownames(temp);
-	if (!Rf_isNull(namesRowR)) {
-		out.rowNames_ = Rcpp::as<std::vector<std::string>>(namesRowR);
+	if (!Rf_isMatrix(in)) {
+		throw(std::string("An R matrix was expected."));
 	}
 
-	std::vector<std::string> namesColVec;
-	SEXP namesColR = colnames(temp);
-	if (!Rf_isNull(namesColR)) {
-		out.colNames_ = Rcpp::as<std::vector<std::string>>(namesColR);
-	}
+	mapRToCPP(in, Rf_nrows(in), Rf_ncols(in), out.mat_);
+
+	SEXP dimNames = Rf_getAttrib(in, R_DimNamesSymbol);
+	if (!Rf_isNull(dimNames)) {
+		SEXP namesRowR = VECTOR_ELT(dimNames, 0);
+		if (!Rf_isNull(namesRowR)) {
+			out.rowNames_ = Rcpp::as<std::vector<std::string>>(namesRowR);
+		}
 
-	for (Index i = 0; i < nrow; ++i) {
-		for (Index j = 0; j < ncol; ++j) {
-			out.mat_(i, j) = temp(i, j);
+		SEXP namesColR = VECTOR_ELT(dimNames, 1);
+		if (!Rf_isNull(namesColR)) {
+			out.colNames_ = Rcpp::as<std::vector<std::string>>(namesColR);
 		}
 	}
 }